@@ -0,0 +1,9 @@
+#ifndef _BACKGROUND_H_
+
+#define _BACKGROUND_H_
+
+#include "tilemap.h"
+
+extern const TileMap Background;
+
+#endif
@@ -0,0 +1,152 @@
+#include <xc.h>
+#include <avr/interrupt.h>
+#include "input.h"
+
+// Button input with a vertical counter debouncer.
+// Every key is one bit, all keys are debounced together with a few byte
+// operations: ct0/ct1 form a 2 bit counter per bit that runs while the
+// sample differs from the debounced state and is reset when they agree.
+// After 4 equal samples the state bit flips. The time in the Timer0
+// interrupt is the same for 2 or 8 keys.
+// Sampling only runs after a pin change interrupt and while a key with
+// auto-repeat is held, otherwise Input_tick returns at once.
+
+// pressed keys as bits (the buttons pull to ground)
+#define INPUT_RAW() ((((~PINB) >> PB1) & 0x01) | ((((~PIND) >> PD1) & 0x01) << KEY_2))
+
+volatile uint8_t input_keys;
+volatile uint8_t input_dropped;
+
+static uint8_t ct0 = 0xFF, ct1 = 0xFF; // vertical counter, 0xFF = idle
+static volatile uint8_t active;		   // 1 = sampling
+static uint8_t sample_div;
+
+static uint8_t queue[INPUT_QUEUE_SIZE];
+static volatile uint8_t head; // written by the ISR
+static volatile uint8_t tail; // written by Input_get
+
+// auto-repeat of the last pressed key
+static uint8_t repeat_mask;
+static uint16_t repeat_delay;
+static uint8_t repeat_interval, repeat_min, repeat_accel;
+static uint8_t repeat_key = 0xFF; // 0xFF = none
+static uint16_t repeat_left;	  // ms until the next repeat event
+static uint8_t repeat_next;		  // interval after the next repeat event
+
+ISR(PCINT0_vect)
+{
+	active = 1;
+}
+
+ISR(PCINT2_vect)
+{
+	active = 1;
+}
+
+void Input_init(void)
+{
+	DDRB &= ~(1 << PORTB1); // input: PB1 -> Button 1
+	PORTB |= (1 << PORTB1); // pull-up resistor
+	DDRD &= ~(1 << PORTD1); // input: PD1 -> Button 2
+	PORTD |= (1 << PORTD1); // pull-up resistor
+
+	PCMSK0 |= (1 << PCINT1);				// PB1
+	PCMSK2 |= (1 << PCINT17);				// PD1
+	PCICR |= (1 << PCIE0) | (1 << PCIE2);
+	active = 1; // take over the current state
+}
+
+// Auto-repeat for the keys in mask: first repeat after delay_ms, then every
+// interval_ms, each repeat accel_ms faster down to min_ms.
+void Input_setRepeat(uint8_t mask, uint16_t delay_ms, uint8_t interval_ms, uint8_t min_ms, uint8_t accel_ms)
+{
+	uint8_t sreg = SREG;
+	cli();
+	repeat_mask = mask;
+	repeat_delay = delay_ms ? delay_ms : 1;
+	repeat_interval = interval_ms ? interval_ms : 1;
+	repeat_min = min_ms ? min_ms : 1;
+	repeat_accel = accel_ms;
+	SREG = sreg;
+}
+
+static void Input_put(uint8_t event)
+{
+	uint8_t next = (head + 1) & (INPUT_QUEUE_SIZE - 1);
+	if (next == tail)
+	{
+		input_dropped++;
+		return;
+	}
+	queue[head] = event;
+	head = next;
+}
+
+// called every ms from the Timer0 interrupt
+void Input_tick(void)
+{
+	uint8_t changed, pressed, released, k;
+
+	if (!active)
+		return;
+
+	if (repeat_key != 0xFF && --repeat_left == 0)
+	{
+		Input_put(INPUT_REPEAT | repeat_key);
+		repeat_left = repeat_next;
+		if (repeat_next > repeat_min + repeat_accel)
+			repeat_next -= repeat_accel;
+		else
+			repeat_next = repeat_min;
+	}
+
+	if (++sample_div < INPUT_SAMPLE_MS)
+		return;
+	sample_div = 0;
+
+	changed = input_keys ^ INPUT_RAW();
+	ct0 = ~(ct0 & changed);
+	ct1 = ct0 ^ (ct1 & changed);
+	changed &= ct0 & ct1; // counter rolled over => 4 equal samples
+	input_keys ^= changed;
+	pressed = changed & input_keys;
+	released = changed & ~input_keys;
+
+	if (changed)
+	{
+		for (k = 0; k < 8; k++) // only runs when a key has changed
+		{
+			if (released & (1 << k))
+			{
+				Input_put(INPUT_RELEASE | k);
+				if (repeat_key == k)
+					repeat_key = 0xFF;
+			}
+			if (pressed & (1 << k))
+			{
+				Input_put(INPUT_PRESS | k);
+				if (repeat_mask & (1 << k)) // the last pressed key repeats
+				{
+					repeat_key = k;
+					repeat_left = repeat_delay;
+					repeat_next = repeat_interval;
+				}
+			}
+		}
+	}
+
+	// idle: all counters reset and no repeat running => wait for a pin change
+	if ((ct0 & ct1) == 0xFF && repeat_key == 0xFF)
+		active = 0;
+}
+
+// next event (type | key), 0 if there is none
+uint8_t Input_get(void)
+{
+	uint8_t event;
+	if (tail == head)
+		return 0;
+	event = queue[tail];
+	tail = (tail + 1) & (INPUT_QUEUE_SIZE - 1);
+	return event;
+}
@@ -0,0 +1,29 @@
+#ifndef _INPUT_H_
+
+#define _INPUT_H_
+
+#include <stdint.h>
+
+// keys, one bit each in the debounced state (up to 8)
+#define KEY_1 0 // Button 1 on PB1
+#define KEY_2 1 // Button 2 on PD1
+
+#define INPUT_SAMPLE_MS 3	 // sample period, 4 equal samples => about 12 ms debounce
+#define INPUT_QUEUE_SIZE 8 // events, power of 2
+
+// events: type | key
+#define INPUT_PRESS 0x40
+#define INPUT_RELEASE 0x80
+#define INPUT_REPEAT 0xC0
+#define INPUT_EVENT_TYPE(e) ((e) & 0xC0)
+#define INPUT_EVENT_KEY(e) ((e) & 0x07)
+
+extern volatile uint8_t input_keys;	   // debounced state, bit set = pressed
+extern volatile uint8_t input_dropped; // events lost because the queue was full
+
+void Input_init(void);
+void Input_setRepeat(uint8_t mask, uint16_t delay_ms, uint8_t interval_ms, uint8_t min_ms, uint8_t accel_ms);
+void Input_tick(void);
+uint8_t Input_get(void);
+
+#endif
@@ -1,156 +1,121 @@
 #define F_CPU 16000000UL
 #include <xc.h>
 #include <avr/interrupt.h>
-
-#define SPI_DDR DDRB
-#define SS PINB2
-#define MOSI PINB3
-#define SCK PINB5
-#define D_C PIND2	// display: Data/Command
-#define Reset PIND3 // display: Reset
-
-// defining global variables
-volatile uint16_t counter;	   // Timer1 counter
-uint16_t i;					   // Counter for the for loop
-volatile uint16_t count_1 = 0; // Counter for Button 1 hold
-volatile uint16_t count_2 = 0; // Counter for Button 2 hold
-
-// Debounce flags for buttons
-volatile uint8_t button_pressed_1 = 0; // Flag for debounced Button 1 press
-volatile uint8_t button_pressed_2 = 0; // Flag for debounced Button 2 press
-
-// Debounce counter variables
-volatile uint8_t prev_count_1 = 0; // Counter for debouncing Button 1
-volatile uint8_t prev_count_2 = 0; // Counter for debouncing Button 2
-
-uint16_t window[] = {0xEF08, 0x1800, 0x1223, 0x135A, 0x1536, 0x1668}; // Array for the initialization of the window: start, format, x1, y1, x2, y2
+#include "hal.h"
+#include "display.h"
+#include "scheduler.h"
+#include "sprite.h"
+#include "background.h"
+#include "spiq.h"
+#include "timer.h"
+#include "input.h"
+
+#define SQUARE_WIDTH 20
+#define SQUARE_HEIGHT 15
+#define COLOUR_BG 0xFFE0	 // gelb
+#define COLOUR_SQUARE 0x7E0 // grün
+#define COLOUR_BALL 0xF800	 // rot
+#define COLOUR_BLOCK 0x001F // blau
+#define FRAME_MS 10			 // render period
+
+#if HAL_TRANSPORT_USART
+#error "HAL_TRANSPORT_USART needs PD1 (TXD0), which is Button 2 here"
+#endif
+
+Sprite *square; // moved with the buttons
+Sprite *ball;	// bounces over the whole screen, on top of the square
+Sprite *block;	// bounces left/right, below the square
 
 // defining the methods
-ISR(TIMER1_COMPA_vect);
 ISR(TIMER0_COMPA_vect);
-void Waitms(const uint16_t msWait);
-void init_Timer1();
 void init_Timer0();
-void SPI_init();
-void SPISend8Bit(uint8_t data);
-void SPISend16Bit(uint16_t data);
-void SendCommandSeq(const uint16_t *data, uint32_t Anzahl);
-void Display_init(void);
+void Task_Move(void);
+void Task_Render(void);
+void Queue_Background(const TileMap *m);
+void Boot_finishDisplay(uint16_t wait, uint32_t since);
 
 // main method
 int main(void)
 {
-	DDRB &= ~(1 << PORTB1);			   // input: PB1 -> Button 1
-	PORTB |= (1 << PORTB1);			   // pull-up resistor
-	DDRD &= ~(1 << PORTD1);			   // input: PD1 -> Button 2
-	PORTD |= (1 << PORTD1);			   // pull-up resistor
-	DDRD |= (1 << D_C) | (1 << Reset); // output: PD2 -> Data/Command; PD3 -> Reset
+	uint16_t boot_wait; // pause of the running display init step
+	uint32_t boot_at;	// end of that step
+
+	Input_init();
+	// held buttons repeat after 100 ms, starting every 10 ms and 1 ms faster
+	// each time down to every 2 ms
+	Input_setRepeat((1 << KEY_1) | (1 << KEY_2), 100, 10, 2, 1);
 
 	init_Timer1();
 	SPI_init();
 	sei();
-	Display_init();
+	// the display reset runs while the rest is set up
+	Display_initStart();
+	boot_wait = Display_initStep();
+	boot_at = Timer_now();
+
 	cli(); // disable global interrupt
 	init_Timer0();
 
-	// draw bg
-	for (i = 0; i < 23232; i++) // 132*176 = 23232
-	{
-		SPISend16Bit(0xFFE0); // gelb 0xFFE0
-	}
+	Sched_init();
+	Sched_add(Task_Move, 0, 1);			// apply button events every tick
+	Sched_add(Task_Render, 1, FRAME_MS); // redraw what changed
+	sei();								// enable global interrupt
+
+	// sprites: the square on the buttons and two that bounce on their own
+	Sprite_init(COLOUR_BG);
+	Sprite_setBackground(&Background, 0); // queued below
+	square = Sprite_add(35, 90, SQUARE_WIDTH, SQUARE_HEIGHT, 1, COLOUR_SQUARE, 0);
+	ball = Sprite_add(10, 10, 8, 8, 2, COLOUR_BALL, 0);
+	ball->vx = 1;
+	ball->vy = 1;
+	ball->flags |= SPRITE_BOUNCE;
+	block = Sprite_add(100, 95, 12, 6, 0, COLOUR_BLOCK, 0);
+	block->vx = -1;
+	block->flags |= SPRITE_BOUNCE;
+
+	Boot_finishDisplay(boot_wait, boot_at);
+
+	// the background goes out in the SPI interrupt
+	Queue_Background(&Background);
+	SPIQ_wait();	 // the sprite functions use the blocking transfers
+	Sprite_render(); // draw the sprites
 
-	// draw square
-	SendCommandSeq(window, 6);
-	for (i = 0; i < 300; i++) // 20*15 = 300
+	// main loop (infinity loop)
+	while (1)
 	{
-		SPISend16Bit(0x7E0); // grün 0x7E0
+		Sched_run();
 	}
+}
 
-	sei(); // enable global interrupt
-
-	// main loop (infinity loop)
-	while (1)
+// move the square on button events: Button 1 right, Button 2 left
+void Task_Move(void)
+{
+	uint8_t event;
+	while ((event = Input_get()) != 0)
 	{
-		;
+		if (INPUT_EVENT_TYPE(event) == INPUT_RELEASE)
+			continue;
+		if (INPUT_EVENT_KEY(event) == KEY_1 && square->x + square->w < DISPLAY_WIDTH) // right edge
+			square->x++;
+		else if (INPUT_EVENT_KEY(event) == KEY_2 && square->x > 0) // left edge
+			square->x--;
 	}
 }
 
-// Timer1 interrupt service routine
-ISR(TIMER1_COMPA_vect)
+// move the bouncing sprites and send what changed in one transaction
+void Task_Render(void)
 {
-	counter++;
+	Sprite_update();
+	Sprite_render();
 }
 
-// Timer0 interrupt service routine
+// Timer0 interrupt service routine: scheduler tick and button sampling,
+// drawing is done by the tasks in the main loop
 ISR(TIMER0_COMPA_vect)
 {
-	// draw square
-	SendCommandSeq(window, 6);
-	for (i = 0; i < 300; i++) // 20*15 = 300
-	{
-		SPISend16Bit(0x7E0); // grün 0x7E0
-	}
-
-	// Debounce Button 1 + checking if the button is held
-	if (!(PINB & (1 << PB1))) // Button 1 is pressed
-	{
-		prev_count_1++;
-		if (prev_count_1 >= 10)
-		{
-			button_pressed_1 = 1;
-			count_1++;
-		}
-	}
-	else
-	{ // Button 1 is released
-		prev_count_1 = 0;
-		button_pressed_1 = 0; // Reset flag
-		count_1 = 0;
-	}
-
-	// Debounce Button 2 + checking if the button is held
-	if (!(PIND & (1 << PD1)))
-	{ // Button 2 is pressed
-		prev_count_2++;
-		if (prev_count_2 >= 10) // Check debounce threshold
-		{
-			button_pressed_2 = 1;
-			count_2++;
-		}
-	}
-	else
-	{ // Button 2 is released
-		prev_count_2 = 0;
-		button_pressed_2 = 0; // Reset flag
-		count_2 = 0;
-	}
-
-	if (button_pressed_1 && window[4] < 0x1583 && (count_1 == 1 || count_1 >= 100))
-	{
-		// erase square
-		SendCommandSeq(window, 6);
-		for (i = 0; i < 300; i++)
-		{
-			SPISend16Bit(0xFFE0); // gelb 0xFFE0
-		}
-		// move square
-		window[2] += 0x1; // x1 move right
-		window[4] += 0x1; // x2 move right
-	}
-
-	// check for a button press
-	if (button_pressed_2 && window[2] > 0x1200 && (count_2 == 1 || count_2 >= 100)) // Button 2 pressed & square is not at the left edge & button is pressed for 1 or 100 cycles
-	{
-		// erase square
-		SendCommandSeq(window, 6);
-		for (i = 0; i < 300; i++)
-		{
-			SPISend16Bit(0xFFE0); // gelb 0xFFE0
-		}
-		// move square
-		window[2] -= 0x1; // x1 move left
-		window[4] -= 0x1; // x2 move left
-	}
+	Sched_tick();
+	Input_tick();
+	Sched_checkOverrun();
 }
 
 // Timer0 initialization
@@ -162,110 +127,45 @@ void init_Timer0()
 	OCR0A = 249;
 }
 
-// Wait function
-void Waitms(const uint16_t msWait)
-{
-	static uint16_t aktTime, diff;
-	uint16_t countertemp;
-	cli(); // da 16 bit Variablen könnte ohne cli() sei() sich der Wert von counter ändern, bevor er komplett aktTime zugewiesen wird.
-	aktTime = counter;
-	sei();
-	do
-	{
-		cli();
-		countertemp = counter;
-		sei();
-		diff = countertemp + ~aktTime + 1;
-	} while (diff < msWait);
-}
-
-// Timer1 initialization
-void init_Timer1()
-{
-	TCCR1B |= (1 << CS10) | (1 << WGM12); // TimerCounter1ControlRegisterB Clock Select |(1<<CS10)=>prescaler = 1; WGM12=>CTC mode
-	TIMSK1 |= (1 << OCIE1A);			  // TimerCounter1 Interrupt Mask Register: Output Compare Overflow Interrupt Enable
-	OCR1A = 15999;						  // direkte Zahl macht Sinn; overflow register OCR1A berechnet mit division 64 => unlogischer Registerwert
-}
-
-// SPI initialization
-void SPI_init()
+// Queue the tile background tile by tile (window + one blit of the tile from
+// flash). Tiles of the last column and row are cut at the screen edge, cut
+// columns are sent line by line.
+void Queue_Background(const TileMap *m)
 {
-	// set CS, MOSI and SCK to output
-	SPI_DDR |= (1 << SS) | (1 << MOSI) | (1 << SCK);
+	uint8_t col, row, line, x, y, w, h;
+	const uint16_t *tile;
 
-	// enable SPI, set as master, and clock to fosc/4 or 128
-	SPCR = (1 << SPE) | (1 << MSTR); // | (1 << SPR1) | (1 << SPR0); 4MHz bzw. 125kHz
-									 // SPSR |= 0x1;
-}
-// SPI send 8 bit
-void SPISend8Bit(uint8_t data)
-{
-	//	farbe = data;
-	PORTB &= ~(1 << SS); // CS low
-	SPDR = data;		 // load data into register
-	while (!(SPSR & (1 << SPIF)))
-		;				// wait for transmission complete
-	PORTB |= (1 << SS); // CS high
+	for (row = 0; row < m->rows && row * TILE_SIZE < DISPLAY_HEIGHT; row++)
+	{
+		y = row * TILE_SIZE;
+		h = (DISPLAY_HEIGHT - y < TILE_SIZE) ? DISPLAY_HEIGHT - y : TILE_SIZE;
+		for (col = 0; col < m->cols && col * TILE_SIZE < DISPLAY_WIDTH; col++)
+		{
+			x = col * TILE_SIZE;
+			w = (DISPLAY_WIDTH - x < TILE_SIZE) ? DISPLAY_WIDTH - x : TILE_SIZE;
+			tile = m->tiles + (uint16_t)m->map[row * m->cols + col] * (TILE_SIZE * TILE_SIZE);
+			SPIQ_window(x, y, w, h);
+			if (w == TILE_SIZE)
+				SPIQ_blit(tile, h * TILE_SIZE);
+			else
+				for (line = 0; line < h; line++)
+					SPIQ_blit(tile + line * TILE_SIZE, w);
+		}
+	}
 }
 
-// SPI send 16 bit
-void SPISend16Bit(uint16_t data)
+// Run the remaining display init steps. Each pause counts from the end of
+// its step (since), the time the caller spent on other work is taken off.
+void Boot_finishDisplay(uint16_t wait, uint32_t since)
 {
-	uint8_t SendeByte;
-	SendeByte = (data >> 8) & 0xFF; // High-Byte des Kommandos
-	SPISend8Bit(SendeByte);
-	SendeByte = data & 0xFF; // Low-Byte des Kommandos
-	SPISend8Bit(SendeByte);
-}
+	uint32_t passed;
 
-// Send command sequence
-void SendCommandSeq(const uint16_t *data, uint32_t Anzahl)
-{
-	uint32_t index;							 // Index für die Anzahl der Kommandos
-	uint8_t SendeByte;						 // Variable für die zu sendenden Bytes
-	for (index = 0; index < Anzahl; index++) // Schleife für die Anzahl der Kommandos
+	while (wait != DISPLAY_INIT_DONE)
 	{
-		PORTD |= (1 << D_C);				   // Data/Command auf High => Kommando-Modus
-		SendeByte = (data[index] >> 8) & 0xFF; // High-Byte des Kommandos
-		SPISend8Bit(SendeByte);
-		SendeByte = data[index] & 0xFF; // Low-Byte des Kommandos
-		SPISend8Bit(SendeByte);
-		PORTD &= ~(1 << D_C); // Data/Command auf Low => Daten-Modus
+		passed = Timer_now() - since;
+		if (passed < wait)
+			Waitms(wait - passed);
+		wait = Display_initStep();
+		since = Timer_now();
 	}
 }
-// Display initialisation
-void Display_init(void)
-{
-	const uint16_t InitData[] = {
-		// Initialisierungsdaten fuer 16 Bit Farben Modus
-		0xFDFD, 0xFDFD,
-		// pause
-		0xEF00, 0xEE04, 0x1B04, 0xFEFE, 0xFEFE,
-		0xEF90, 0x4A04, 0x7F3F, 0xEE04, 0x4306,
-		// pause
-		0xEF90, 0x0983, 0x0800, 0x0BAF, 0x0A00,
-		0x0500, 0x0600, 0x0700, 0xEF00, 0xEE0C,
-		0xEF90, 0x0080, 0xEFB0, 0x4902, 0xEF00,
-		0x7F01, 0xE181, 0xE202, 0xE276, 0xE183,
-		0x8001, 0xEF90, 0x0000,
-		// pause
-		0xEF08, 0x1800, 0x1200, 0x1583, 0x1300,
-		0x16AF // Hochformat 132 x 176 Pixel
-	};
-	Waitms(300);
-	PORTD &= ~(1 << Reset); // Reset-Eingang des Displays auf Low => Beginn Hardware-Reset
-	Waitms(75);
-	PORTB |= (1 << SS); // SSEL auf High
-	Waitms(75);
-	PORTD |= (1 << D_C); // Data/Command auf High
-	Waitms(75);
-	PORTD |= (1 << Reset); // Reset-Eingang des Displays auf High => Ende Hardware Reset
-	Waitms(75);
-	SendCommandSeq(&InitData[0], 2);
-	Waitms(75);
-	SendCommandSeq(&InitData[2], 10);
-	Waitms(75);
-	SendCommandSeq(&InitData[12], 23);
-	Waitms(75);
-	SendCommandSeq(&InitData[35], 6);
-}
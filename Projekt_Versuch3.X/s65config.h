@@ -0,0 +1,23 @@
+#ifndef _S65CONFIG_H_
+
+#define _S65CONFIG_H_
+
+// Build settings of the S65Driver library for Versuch3. The library is
+// compiled with this project's directory on its include path, so the driver
+// and the project always see the same values. A -D on the command line
+// overrides them, but then it has to be given to the library as well
+// (make -C ../S65Driver DEFS=...).
+
+#ifndef DISPLAY_ORIENTATION
+#define DISPLAY_ORIENTATION 0 // DISPLAY_ROT_0, Hochformat 132 x 176
+#endif
+
+// Also available (defaults in S65Driver/display.h, hal.h):
+// DISPLAY_RGB332 1     enable the 8 bit colour mode (command words not
+//                      confirmed on a panel yet)
+// DISPLAY_COLOURS 8    start in RGB332 mode (needs DISPLAY_RGB332 1)
+// DISPLAY_SLOW_INIT    long init pauses of the first version
+// HAL_TRANSPORT_USART and PROFILE need USART0, whose TXD0 (PD1) is Button 2
+// here, main.c refuses them.
+
+#endif
@@ -0,0 +1,104 @@
+#include <xc.h>
+#include <avr/interrupt.h>
+#include "scheduler.h"
+
+// Cooperative scheduler for the main loop.
+// The Timer0 ISR only counts ticks, Sched_run() turns elapsed ticks into
+// ready tasks and runs them in priority order (0 = highest). The table is
+// kept sorted by priority, so the first ready entry is always the next one.
+
+typedef struct
+{
+	SchedTask task;
+	uint8_t priority;
+	uint16_t period;	// ms between two runs
+	uint16_t remaining; // ms until the next run
+	uint8_t ready;		// 1 = due, several missed periods run only once
+} SchedEntry;
+
+volatile uint16_t sched_ticks;
+volatile uint16_t sched_tick_overruns;
+uint16_t sched_frame_overruns;
+
+static SchedEntry tasks[SCHED_MAX_TASKS];
+static uint8_t task_count;
+static uint16_t last_ticks;
+
+// read the 16 bit tick counter in one piece
+static uint16_t Sched_now(void)
+{
+	uint16_t now;
+	cli();
+	now = sched_ticks;
+	sei();
+	return now;
+}
+
+void Sched_init(void)
+{
+	task_count = 0;
+	sched_frame_overruns = 0;
+	last_ticks = Sched_now();
+}
+
+// add a periodic task, returns 0 if the table is full
+uint8_t Sched_add(SchedTask task, uint8_t priority, uint16_t period_ms)
+{
+	uint8_t k;
+	if (task_count >= SCHED_MAX_TASKS)
+		return 0;
+	if (period_ms == 0)
+		period_ms = 1;
+	// insertion into the sorted table, equal priorities keep their order
+	k = task_count;
+	while (k > 0 && tasks[k - 1].priority > priority)
+	{
+		tasks[k] = tasks[k - 1];
+		k--;
+	}
+	tasks[k].task = task;
+	tasks[k].priority = priority;
+	tasks[k].period = period_ms;
+	tasks[k].remaining = period_ms;
+	tasks[k].ready = 0;
+	task_count++;
+	return 1;
+}
+
+// one pass of the main loop
+void Sched_run(void)
+{
+	uint16_t now = Sched_now();
+	uint16_t elapsed = now - last_ticks;
+	uint16_t start = now;
+	uint8_t k;
+
+	last_ticks = now;
+	for (k = 0; k < task_count; k++) // release the tasks whose period ran out
+	{
+		if (elapsed >= tasks[k].remaining)
+		{
+			uint16_t late = elapsed - tasks[k].remaining;
+			tasks[k].remaining = tasks[k].period - late % tasks[k].period;
+			tasks[k].ready = 1;
+		}
+		else
+		{
+			tasks[k].remaining -= elapsed;
+		}
+	}
+
+	for (k = 0; k < task_count; k++) // highest priority first
+	{
+		if (!tasks[k].ready)
+			continue;
+		if ((uint16_t)(Sched_now() - start) >= SCHED_FRAME_BUDGET_MS)
+		{
+			// budget used up: the rest stays ready for the next pass
+			sched_frame_overruns++;
+			return;
+		}
+		tasks[k].ready = 0;
+		tasks[k].task();
+	}
+}
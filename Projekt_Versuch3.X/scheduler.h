@@ -0,0 +1,35 @@
+#ifndef _SCHEDULER_H_
+
+#define _SCHEDULER_H_
+
+#include <stdint.h>
+
+#define SCHED_MAX_TASKS 8		// size of the task table
+#define SCHED_FRAME_BUDGET_MS 8 // time per pass before lower priority tasks are deferred
+
+typedef void (*SchedTask)(void);
+
+extern volatile uint16_t sched_ticks;		   // 1 ms ticks, only written by the Timer0 ISR
+extern volatile uint16_t sched_tick_overruns;  // Timer0 ISR still running when the next tick was due
+extern uint16_t sched_frame_overruns;		   // passes that ran out of frame budget
+
+void Sched_init(void);
+uint8_t Sched_add(SchedTask task, uint8_t priority, uint16_t period_ms);
+void Sched_run(void);
+
+// called at the start of the Timer0 ISR
+static inline void Sched_tick(void)
+{
+	sched_ticks++;
+}
+
+// called at the end of the Timer0 ISR: if the compare flag is set again the
+// ISR took longer than one tick
+#define Sched_checkOverrun()          \
+	do                                \
+	{                                 \
+		if (TIFR0 & (1 << OCF0A))     \
+			sched_tick_overruns++;    \
+	} while (0)
+
+#endif
@@ -0,0 +1,203 @@
+#include <xc.h>
+#include <avr/interrupt.h>
+#include "hal.h"
+#include "display.h"
+#include "spiq.h"
+
+// Asynchronous display transfers.
+// SPIQ_window/fill/blit put a command into a ring buffer and return at once,
+// the SPI_STC interrupt sends one byte per interrupt until the queue is
+// empty. Only a full queue makes the caller wait.
+//
+// Idle state (as after SPI_init): SPIE off, CS high, SPIF set by a dummy
+// byte, so the blocking functions of hal.h can be used after SPIQ_wait().
+// Starting the queue only sets CS low and SPIE, the pending SPIF triggers the
+// first interrupt right away.
+//
+// Cost: the interrupt needs about 40 cycles per byte, more than the 16
+// cycles a byte takes on the bus at fosc/2. A queued transfer therefore
+// takes about 2.5 times as long as the blocking one and leaves main() only a
+// few cycles per byte. The gain is that main() and the Timer0 interrupt
+// (higher priority than SPI_STC) are never blocked for a whole frame.
+// The interrupt calls no function, so it only saves the registers it uses.
+// SPIQ_window works out the window words for the current orientation when
+// it is queued, the interrupt only puts the controller coordinates into the
+// fixed command words; starting a new command costs about 30 cycles more.
+// In 8 bit colour mode a pixel is one byte and one interrupt.
+
+// commands
+#define SPIQ_WINDOW 0 // mode, value = x1 | y1 << 8, count = x2 | y2 << 8 (controller)
+#define SPIQ_FILL 1	  // value = colour, count = pixels
+#define SPIQ_BLIT 2	  // data = const table in flash, count = words
+
+typedef struct
+{
+	uint8_t op;
+	uint8_t mode; // SPIQ_WINDOW: address mode
+	union
+	{
+		uint16_t value;			// SPIQ_WINDOW, SPIQ_FILL
+		HalFlash data;			// SPIQ_BLIT
+	} arg;
+	uint16_t count;
+} SpiqCmd;
+
+static SpiqCmd queue[SPIQ_SIZE];
+static volatile uint8_t head; // next free entry, only written by main()
+static volatile uint8_t tail; // next entry to send, only written by the ISR
+
+uint8_t spiq_high_water;
+
+// state of the command being sent, only used by the ISR
+static uint8_t op = SPIQ_FILL;
+static uint16_t left;		// words left
+static uint16_t colour;		// SPIQ_FILL
+static HalFlash flash;		// SPIQ_BLIT
+static const uint16_t *src; // SPIQ_WINDOW: window[]
+static uint16_t window[6] = {0xEF08, 0x1800, 0x1200, 0x1300, 0x1500, 0x1600};
+static uint8_t low;			// low byte of the current word
+static uint8_t low_pending; // 1 = low byte is the next byte
+
+ISR(SPI_STC_vect)
+{
+	uint16_t word;
+	SpiqCmd *cmd;
+
+	if (low_pending)
+	{
+		SPDR = low;
+		low_pending = 0;
+		return;
+	}
+	while (!left) // current command done => next one
+	{
+		if (op == SPIQ_WINDOW)
+			PORTD &= ~(1 << HAL_DC); // window sent => Daten-Modus
+		if (tail == head)		  // queue empty => idle
+		{
+			op = SPIQ_FILL;
+			SPCR &= ~(1 << SPIE);
+			PORTB |= (1 << HAL_CS); // CS high
+			SPDR = 0;			// dummy byte sets SPIF for the blocking functions
+			return;
+		}
+		cmd = &queue[tail];
+		op = cmd->op;
+		left = cmd->count;
+		if (op == SPIQ_WINDOW)
+		{
+			window[1] = 0x1800 | cmd->mode;
+			window[2] = 0x1200 | (uint8_t)cmd->arg.value;
+			window[3] = 0x1300 | (cmd->arg.value >> 8);
+			window[4] = 0x1500 | (uint8_t)cmd->count;
+			window[5] = 0x1600 | (cmd->count >> 8);
+			src = window;
+			left = 6;
+			PORTD |= (1 << HAL_DC); // Kommando-Modus
+		}
+		else if (op == SPIQ_FILL)
+			colour = cmd->arg.value;
+		else
+			flash = cmd->arg.data;
+		tail = (tail + 1) & (SPIQ_SIZE - 1);
+	}
+	left--;
+	if (op == SPIQ_FILL)
+		word = colour;
+	else if (op == SPIQ_BLIT)
+		word = HAL_ReadFlash16(&flash);
+	else
+		word = *src++;
+	if (op != SPIQ_WINDOW && display_colours == DISPLAY_COLOURS_8)
+	{
+		SPDR = RGB565_TO_332(word);
+		return;
+	}
+	SPDR = word >> 8;
+	low = word;
+	low_pending = 1;
+}
+
+// Reserve the next entry, waits while the queue is full.
+static SpiqCmd *SPIQ_next(void)
+{
+	while (((head + 1) & (SPIQ_SIZE - 1)) == tail) // full: wait for the interrupt
+		;
+	return &queue[head];
+}
+
+// Publish the entry of SPIQ_next and start the transfer if the bus is idle.
+static void SPIQ_commit(void)
+{
+	uint8_t next = (head + 1) & (SPIQ_SIZE - 1);
+	uint8_t depth;
+
+	head = next;
+
+	depth = (next - tail) & (SPIQ_SIZE - 1);
+	if (depth > spiq_high_water)
+		spiq_high_water = depth;
+
+	if (!(SPCR & (1 << SPIE))) // idle => start
+	{
+		SPI_WAIT();			 // dummy byte of the last idle transition is out
+		PORTB &= ~(1 << HAL_CS); // CS low
+		SPCR |= (1 << SPIE); // SPIF is set => first interrupt follows at once
+	}
+}
+
+// Queue a display window, the following pixels fill it.
+void SPIQ_window(uint8_t x, uint8_t y, uint8_t w, uint8_t h)
+{
+	uint16_t words[6];
+	SpiqCmd *cmd;
+
+	Display_WindowWords(words, x, y, w, h); // outside the interrupt
+	cmd = SPIQ_next();
+	cmd->op = SPIQ_WINDOW;
+	cmd->mode = words[1];
+	cmd->arg.value = (uint8_t)words[2] | (words[3] << 8);
+	cmd->count = (uint8_t)words[4] | (words[5] << 8);
+	SPIQ_commit();
+}
+
+// Queue count pixels of one colour.
+void SPIQ_fill(uint16_t colour, uint16_t count)
+{
+	SpiqCmd *cmd;
+	if (!count)
+		return;
+	cmd = SPIQ_next();
+	cmd->op = SPIQ_FILL;
+	cmd->arg.value = colour;
+	cmd->count = count;
+	SPIQ_commit();
+}
+
+// Queue count words of a const table in flash.
+void SPIQ_blit(const uint16_t *data, uint16_t count)
+{
+	SpiqCmd *cmd;
+	if (!count)
+		return;
+	cmd = SPIQ_next();
+	cmd->op = SPIQ_BLIT;
+	cmd->arg.data = HAL_FLASH(data);
+	cmd->count = count;
+	SPIQ_commit();
+}
+
+// 1 while queued data is still being sent
+uint8_t SPIQ_busy(void)
+{
+	return (SPCR & (1 << SPIE)) != 0;
+}
+
+// Wait until the queue is empty and the bus idle. Needed before the blocking
+// display functions are used again.
+void SPIQ_wait(void)
+{
+	while (SPIQ_busy())
+		;
+	SPI_WAIT();
+}
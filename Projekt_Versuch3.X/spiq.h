@@ -0,0 +1,17 @@
+#ifndef _SPIQ_H_
+
+#define _SPIQ_H_
+
+#include <stdint.h>
+
+#define SPIQ_SIZE 16 // queue entries, power of 2
+
+extern uint8_t spiq_high_water; // deepest queue seen, for tuning SPIQ_SIZE
+
+void SPIQ_window(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+void SPIQ_fill(uint16_t colour, uint16_t count);
+void SPIQ_blit(const uint16_t *data, uint16_t count);
+uint8_t SPIQ_busy(void);
+void SPIQ_wait(void);
+
+#endif
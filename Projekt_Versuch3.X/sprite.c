@@ -0,0 +1,320 @@
+#include "hal.h"
+#include "display.h"
+#include "sprite.h"
+#include "tilemap.h"
+
+// Sprite engine on top of the display window registers.
+// Sprite_render collects the screen areas that changed since the last frame
+// (uncovered old area, newly covered area), composes every area line by line
+// from the background (solid colour or tile map) and the sprites in z order
+// and sends all of them in one SPI transaction: window words with D_C high,
+// pixels with D_C low.
+// A line that ends up in one colour is sent with Display_RepeatColour, any
+// other line is built in a line buffer first.
+
+static Sprite sprites[SPRITE_MAX];
+static uint8_t order[SPRITE_MAX]; // active sprites, lowest z first
+static uint8_t order_count;
+static uint16_t sprite_bg;
+static const TileMap *sprite_map; // 0: solid background sprite_bg
+
+static Rect dirty[SPRITE_DIRTY_MAX];
+static uint8_t dirty_count;
+
+static uint16_t line[DISPLAY_LONG]; // widest line of all orientations
+
+void Sprite_init(uint16_t bg)
+{
+	uint8_t i;
+	for (i = 0; i < SPRITE_MAX; i++)
+		sprites[i].flags = 0;
+	order_count = 0;
+	dirty_count = 0;
+	sprite_bg = bg;
+	sprite_map = 0;
+}
+
+// Add a sprite (bitmap == 0: solid colour). Returns 0 if the table is full.
+// Sprites with equal z are drawn in the order they were added.
+Sprite *Sprite_add(int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t z, uint16_t colour, const uint16_t *bitmap)
+{
+	uint8_t i, k;
+	Sprite *s;
+
+	for (i = 0; i < SPRITE_MAX && (sprites[i].flags & SPRITE_ACTIVE); i++)
+		;
+	if (i == SPRITE_MAX)
+		return 0;
+
+	s = &sprites[i];
+	s->x = x;
+	s->y = y;
+	s->w = w;
+	s->h = h;
+	s->vx = 0;
+	s->vy = 0;
+	s->z = z;
+	s->flags = SPRITE_ACTIVE;
+	s->colour = colour;
+	s->bitmap = bitmap;
+	s->drawn.w = 0;
+	s->drawn.h = 0;
+
+	// insert into the z order
+	for (k = order_count; k > 0 && sprites[order[k - 1]].z > z; k--)
+		order[k] = order[k - 1];
+	order[k] = i;
+	order_count++;
+	return s;
+}
+
+static void Dirty_add(const Rect *r)
+{
+	Rect *d;
+	uint8_t x2, y2;
+
+	if (r->w == 0 || r->h == 0)
+		return;
+	if (dirty_count < SPRITE_DIRTY_MAX)
+	{
+		dirty[dirty_count++] = *r;
+		return;
+	}
+	// list full: grow the last entry to the bounding box
+	d = &dirty[SPRITE_DIRTY_MAX - 1];
+	x2 = (d->x + d->w > r->x + r->w) ? d->x + d->w : r->x + r->w;
+	y2 = (d->y + d->h > r->y + r->h) ? d->y + d->h : r->y + r->h;
+	if (r->x < d->x)
+		d->x = r->x;
+	if (r->y < d->y)
+		d->y = r->y;
+	d->w = x2 - d->x;
+	d->h = y2 - d->y;
+}
+
+// Add the part of rectangle a that is not covered by rectangle b.
+// a \ b is split into at most four rectangles: the rows above and below the
+// overlap over the full width of a, and the columns left and right of the
+// overlap over the overlap height.
+static void Dirty_addDifference(const Rect *a, const Rect *b)
+{
+	uint8_t ax2 = a->x + a->w; // right/bottom edges are exclusive
+	uint8_t ay2 = a->y + a->h;
+	uint8_t ix1 = (a->x > b->x) ? a->x : b->x; // intersection
+	uint8_t iy1 = (a->y > b->y) ? a->y : b->y;
+	uint8_t ix2 = (ax2 < b->x + b->w) ? ax2 : b->x + b->w;
+	uint8_t iy2 = (ay2 < b->y + b->h) ? ay2 : b->y + b->h;
+	Rect r;
+
+	if (ix1 >= ix2 || iy1 >= iy2) // no overlap => all of a
+	{
+		Dirty_add(a);
+		return;
+	}
+	r.x = a->x;
+	r.w = a->w;
+	if (iy1 > a->y) // above
+	{
+		r.y = a->y;
+		r.h = iy1 - a->y;
+		Dirty_add(&r);
+	}
+	if (ay2 > iy2) // below
+	{
+		r.y = iy2;
+		r.h = ay2 - iy2;
+		Dirty_add(&r);
+	}
+	r.y = iy1;
+	r.h = iy2 - iy1;
+	if (ix1 > a->x) // left
+	{
+		r.x = a->x;
+		r.w = ix1 - a->x;
+		Dirty_add(&r);
+	}
+	if (ax2 > ix2) // right
+	{
+		r.x = ix2;
+		r.w = ax2 - ix2;
+		Dirty_add(&r);
+	}
+}
+
+// Remove a sprite, its area is given back to the background at the next
+// Sprite_render.
+void Sprite_remove(Sprite *s)
+{
+	uint8_t i, k;
+	uint8_t index = s - sprites;
+
+	if (!(s->flags & SPRITE_ACTIVE))
+		return;
+	Dirty_add(&s->drawn);
+	s->flags = 0;
+	for (i = 0, k = 0; i < order_count; i++)
+		if (order[i] != index)
+			order[k++] = order[i];
+	order_count = k;
+}
+
+// Use a tile map as background (0: back to the solid colour of Sprite_init).
+// redraw = 1: the whole screen is drawn at the next Sprite_render,
+// redraw = 0: the caller has drawn the background already.
+void Sprite_setBackground(const TileMap *map, uint8_t redraw)
+{
+	Rect screen = {0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT};
+	sprite_map = map;
+	dirty_count = 0;
+	if (redraw)
+		Dirty_add(&screen);
+}
+
+// Move all sprites by their velocity.
+void Sprite_update(void)
+{
+	uint8_t i;
+	Sprite *s;
+
+	for (i = 0; i < SPRITE_MAX; i++)
+	{
+		s = &sprites[i];
+		if (!(s->flags & SPRITE_ACTIVE))
+			continue;
+		if (s->flags & SPRITE_BOUNCE)
+		{
+			if ((s->vx < 0 && s->x + s->vx < 0) || (s->vx > 0 && s->x + s->vx + s->w > DISPLAY_WIDTH))
+				s->vx = -s->vx;
+			if ((s->vy < 0 && s->y + s->vy < 0) || (s->vy > 0 && s->y + s->vy + s->h > DISPLAY_HEIGHT))
+				s->vy = -s->vy;
+		}
+		s->x += s->vx;
+		s->y += s->vy;
+	}
+}
+
+// visible part of a sprite (clipped against the screen)
+static void Sprite_visible(const Sprite *s, Rect *r)
+{
+	int16_t x1 = s->x, y1 = s->y;
+	int16_t x2 = s->x + s->w, y2 = s->y + s->h;
+
+	if (x1 < 0)
+		x1 = 0;
+	if (y1 < 0)
+		y1 = 0;
+	if (x2 > DISPLAY_WIDTH)
+		x2 = DISPLAY_WIDTH;
+	if (y2 > DISPLAY_HEIGHT)
+		y2 = DISPLAY_HEIGHT;
+	if (x1 >= x2 || y1 >= y2)
+	{
+		r->x = r->y = r->w = r->h = 0;
+		return;
+	}
+	r->x = x1;
+	r->y = y1;
+	r->w = x2 - x1;
+	r->h = y2 - y1;
+}
+
+// Send line y of area r: background, then every sprite on top in z order.
+static void Sprite_composeLine(const Rect *r, uint8_t y)
+{
+	uint8_t x2 = r->x + r->w;
+	uint16_t colour = sprite_bg;
+	uint8_t uniform = 1; // whole line is colour, line[] not used yet
+	uint8_t k, i, sx1, sx2;
+	const Sprite *s;
+	const Rect *d;
+	HalFlash src;
+
+	if (sprite_map)
+	{
+		TileMap_line(sprite_map, r->x, y, r->w, line);
+		uniform = 0;
+	}
+	for (k = 0; k < order_count; k++)
+	{
+		s = &sprites[order[k]];
+		d = &s->drawn;
+		if (y < d->y || y >= d->y + d->h)
+			continue;
+		sx1 = (d->x > r->x) ? d->x : r->x;
+		sx2 = (d->x + d->w < x2) ? d->x + d->w : x2;
+		if (sx1 >= sx2)
+			continue;
+		if (!s->bitmap && sx1 == r->x && sx2 == x2) // covers the whole line
+		{
+			colour = s->colour;
+			uniform = 1;
+			continue;
+		}
+		if (uniform)
+		{
+			for (i = 0; i < r->w; i++)
+				line[i] = colour;
+			uniform = 0;
+		}
+		if (s->bitmap)
+		{
+			src = HAL_FLASH(s->bitmap + (uint16_t)(y - s->y) * s->w + (sx1 - s->x));
+			for (i = sx1 - r->x; i < sx2 - r->x; i++)
+				line[i] = HAL_ReadFlash16(&src);
+		}
+		else
+		{
+			for (i = sx1 - r->x; i < sx2 - r->x; i++)
+				line[i] = s->colour;
+		}
+	}
+	if (uniform)
+		Display_RepeatColour(colour, r->w);
+	else if (display_colours == DISPLAY_COLOURS_8)
+		for (i = 0; i < r->w; i++)
+			Display_PutColour(line[i]);
+	else
+		SPIStream16Bit(line, r->w);
+}
+
+// Bring the display in line with the sprite table.
+// A solid sprite that moved only sends the uncovered and the newly covered
+// strips, a bitmap sprite (or one with SPRITE_REDRAW) is sent completely.
+// Nothing is sent if no sprite changed.
+void Sprite_render(void)
+{
+	uint8_t i, k, y;
+	Sprite *s;
+	Rect now;
+
+	for (i = 0; i < SPRITE_MAX; i++)
+	{
+		s = &sprites[i];
+		if (!(s->flags & SPRITE_ACTIVE))
+			continue;
+		Sprite_visible(s, &now);
+		if (!(s->flags & SPRITE_REDRAW) && now.x == s->drawn.x && now.y == s->drawn.y &&
+			now.w == s->drawn.w && now.h == s->drawn.h)
+			continue; // not moved
+		if (s->drawn.w)
+			Dirty_addDifference(&s->drawn, &now);
+		if (s->bitmap || (s->flags & SPRITE_REDRAW) || !s->drawn.w)
+			Dirty_add(&now);
+		else
+			Dirty_addDifference(&now, &s->drawn);
+		s->drawn = now;
+		s->flags &= ~SPRITE_REDRAW;
+	}
+	if (!dirty_count)
+		return;
+
+	SPI_begin();
+	for (k = 0; k < dirty_count; k++)
+	{
+		Display_OpenWindow(dirty[k].x, dirty[k].y, dirty[k].w, dirty[k].h);
+		for (y = dirty[k].y; y < dirty[k].y + dirty[k].h; y++)
+			Sprite_composeLine(&dirty[k], y);
+	}
+	SPI_end();
+	dirty_count = 0;
+}
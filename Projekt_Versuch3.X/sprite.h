@@ -0,0 +1,41 @@
+#ifndef _SPRITE_H_
+
+#define _SPRITE_H_
+
+#include <stdint.h>
+#include "tilemap.h"
+
+#define SPRITE_MAX 8	   // size of the sprite table
+#define SPRITE_DIRTY_MAX 16 // dirty rectangles per frame, more are merged
+
+// flags
+#define SPRITE_ACTIVE 0x01 // slot in use
+#define SPRITE_BOUNCE 0x02 // reverse the velocity at the screen edges
+#define SPRITE_REDRAW 0x04 // colour or bitmap changed, draw the whole sprite
+
+// rectangle on the screen (x, y = top left corner)
+typedef struct
+{
+	uint8_t x, y, w, h;
+} Rect;
+
+typedef struct
+{
+	int16_t x, y;			// top left corner, may be partly off screen
+	uint8_t w, h;
+	int8_t vx, vy;			// pixels per Sprite_update
+	uint8_t z;				// higher z is drawn on top
+	uint8_t flags;
+	uint16_t colour;		// used if bitmap == 0
+	const uint16_t *bitmap; // w * h RGB565 pixels row by row, const table in flash
+	Rect drawn;				// visible part at the last Sprite_render (w == 0: nothing)
+} Sprite;
+
+void Sprite_init(uint16_t bg);
+Sprite *Sprite_add(int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t z, uint16_t colour, const uint16_t *bitmap);
+void Sprite_remove(Sprite *s);
+void Sprite_setBackground(const TileMap *map, uint8_t redraw);
+void Sprite_update(void);
+void Sprite_render(void);
+
+#endif
@@ -0,0 +1,26 @@
+#include "hal.h"
+#include "tilemap.h"
+
+// Build w pixels of screen line y starting at x from the tile map.
+// Every tile touched by the line is read once with sequential flash reads,
+// a full tile row is 8 HAL_ReadFlash16 calls without address arithmetic.
+void TileMap_line(const TileMap *m, uint8_t x, uint8_t y, uint8_t w, uint16_t *line)
+{
+	const uint8_t *cell = m->map + (uint16_t)(y / TILE_SIZE) * m->cols + x / TILE_SIZE;
+	uint8_t ty = y % TILE_SIZE;
+	uint8_t tx = x % TILE_SIZE;
+	uint8_t n;
+	HalFlash src;
+
+	while (w)
+	{
+		src = HAL_FLASH(m->tiles + (uint16_t)*cell++ * (TILE_SIZE * TILE_SIZE) + ty * TILE_SIZE + tx);
+		n = TILE_SIZE - tx;
+		if (n > w)
+			n = w;
+		w -= n;
+		tx = 0;
+		while (n--)
+			*line++ = HAL_ReadFlash16(&src);
+	}
+}
@@ -0,0 +1,20 @@
+#ifndef _TILEMAP_H_
+
+#define _TILEMAP_H_
+
+#include <stdint.h>
+
+#define TILE_SIZE 8 // tiles are 8 x 8 pixels
+
+// Background made of 8 x 8 tiles. map and tiles are const tables in flash,
+// nothing of the background is kept in RAM.
+typedef struct
+{
+	uint8_t cols, rows;		// size of the map in tiles
+	const uint8_t *map;		// cols * rows tile indices, row by row
+	const uint16_t *tiles;	// 64 RGB565 pixels per tile, row by row
+} TileMap;
+
+void TileMap_line(const TileMap *m, uint8_t x, uint8_t y, uint8_t w, uint16_t *line);
+
+#endif
@@ -0,0 +1,98 @@
+#include <xc.h>
+#include <avr/interrupt.h>
+#include "display.h"
+#include "timer.h"
+#include "anim.h"
+
+// Animation player (tables in anim.h).
+// A software timer of the Timer1 service only counts the frame ticks, the
+// steps are drawn by Anim_task in the main loop, every rectangle as one
+// Display_DrawImage. The steps build on each other and cannot be skipped:
+// if the SPI needs longer than period_ms for a step, the ticks that passed
+// in the meantime are counted in anim_dropped and the next step follows at
+// once, so the animation slows down instead of showing a wrong picture.
+
+static const Anim *anim;		 // 0: nothing playing
+static int16_t anim_x, anim_y;
+static uint8_t step;			 // next step, 1..frames
+static const AnimRect *rect;	 // first rectangle of that step
+static uint8_t timer;			 // Timer_start handle, 0 = none
+static volatile uint8_t anim_due; // frame ticks not drawn yet
+
+uint16_t anim_dropped;
+
+// frame tick (Timer1 interrupt)
+static void Anim_tick(void)
+{
+	if (anim_due < 0xFF)
+		anim_due++;
+}
+
+static void Anim_draw(const AnimRect *r, uint8_t n)
+{
+	for (; n; n--, r++)
+		Display_DrawImage(anim_x + r->x, anim_y + r->y, r->w, r->h, r->data, r->length, r->codec);
+}
+
+// Draw the keyframe at (x, y) and play the animation in a loop
+void Anim_play(const Anim *a, int16_t x, int16_t y)
+{
+	Anim_stop();
+	anim = a;
+	anim_x = x;
+	anim_y = y;
+	anim_dropped = 0;
+	Anim_draw(a->rects, a->steps[0]);
+	step = 1;
+	rect = a->rects + a->steps[0];
+	timer = Timer_start(Anim_tick, a->period_ms, a->period_ms);
+}
+
+void Anim_stop(void)
+{
+	if (timer)
+	{
+		Timer_stop(timer);
+		timer = 0;
+	}
+	anim_due = 0;
+	anim = 0;
+}
+
+// Draw the next step right away, without waiting for its tick
+void Anim_next(void)
+{
+	uint8_t n;
+
+	if (!anim)
+		return;
+	n = anim->steps[step];
+	Anim_draw(rect, n);
+	if (step == anim->frames) // back at the first picture
+	{
+		step = 1;
+		rect = anim->rects + anim->steps[0];
+	}
+	else
+	{
+		step++;
+		rect += n;
+	}
+}
+
+// Draw the next step once its frame tick has come (main loop).
+// Returns 1 if a step was drawn.
+uint8_t Anim_task(void)
+{
+	uint8_t due;
+
+	cli();
+	due = anim_due;
+	anim_due = 0;
+	sei();
+	if (!due || !anim)
+		return 0;
+	anim_dropped += due - 1; // ticks without a new picture
+	Anim_next();
+	return 1;
+}
@@ -0,0 +1,38 @@
+#ifndef _ANIM_H_
+
+#define _ANIM_H_
+
+#include <stdint.h>
+#include "display.h"
+
+// Animation generated by tools/imgconv -a. All tables are const in flash.
+// rects holds the keyframe (one rectangle over the whole animation) and
+// then, step by step, only the rectangles that changed since the previous
+// picture, each one an imgconv table with its own codec. Step k (1..frames-1)
+// turns picture k-1 into picture k, step frames turns the last picture back
+// into the first one, so the loop never draws the keyframe again.
+typedef struct
+{
+	uint8_t x, y, w, h; // relative to the top left corner of the animation
+	uint8_t codec;		// IMG_CODEC_*
+	uint16_t length;	// table entries
+	const void *data;
+} AnimRect;
+
+typedef struct
+{
+	uint8_t w, h;
+	uint8_t frames;		   // pictures in the loop
+	uint16_t period_ms;	   // time per picture
+	const AnimRect *rects; // keyframe, then the rectangles of step 1, 2, ...
+	const uint8_t *steps;  // frames + 1 entries: rectangles of the keyframe and of each step
+} Anim;
+
+extern uint16_t anim_dropped; // frame ticks that passed while a step was still being drawn
+
+void Anim_play(const Anim *a, int16_t x, int16_t y);
+void Anim_stop(void);
+void Anim_next(void);
+uint8_t Anim_task(void);
+
+#endif
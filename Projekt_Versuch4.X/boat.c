@@ -0,0 +1,162 @@
+/* generated by tools/imgconv from boat0.png .. boat3.png - do not edit
+   Boat: 48 x 23 Pixel, 4 pictures every 200 ms, 1769 bytes */
+
+#include "boat.h"
+
+static const unsigned char Boat_0_0[761] = {
+0x77, 0x85, 0x16, 0x85, 0x15, 0x84, 0xF5, 0x49, 0xC5, 0x62, 0x47, 0x7C, 0x72, 0x8D, 0x36, 0x85,
+0x36, 0x00, 0x00, 0x84, 0xD4, 0x8D, 0x77, 0x7C, 0x51, 0x8D, 0x56, 0x41, 0xA5, 0x8D, 0x57, 0x74,
+0x10, 0x74, 0x51, 0x7C, 0x92, 0x5A, 0x05, 0x7C, 0x30, 0x39, 0x23, 0x41, 0x84, 0x49, 0xA4, 0x6B,
+0xAE, 0x73, 0xEF, 0x41, 0x63, 0x52, 0x06, 0x5A, 0x26, 0x62, 0x67, 0x73, 0xCF, 0x95, 0xB8, 0x39,
+0x64, 0x6B, 0x8E, 0x74, 0x52, 0x7C, 0x93, 0x49, 0x84, 0x49, 0xE6, 0x4A, 0xCC, 0x52, 0x89, 0x62,
+0x46, 0x73, 0xF0, 0x74, 0x31, 0x7C, 0x52, 0x7C, 0xB3, 0x8D, 0x98, 0x94, 0xB2, 0x10, 0xC3, 0x10,
+0xE4, 0x30, 0xE2, 0x39, 0x43, 0x41, 0x85, 0x52, 0x69, 0x59, 0xE5, 0x62, 0x26, 0x6B, 0xF0, 0x7C,
+0x10, 0x84, 0xB4, 0x95, 0x77, 0x95, 0x97, 0x9D, 0x55, 0x00, 0x21, 0x08, 0x61, 0x08, 0x82, 0x21,
+0x86, 0x29, 0x86, 0x29, 0xC7, 0x32, 0x08, 0x41, 0x42, 0x42, 0xAB, 0x49, 0xA5, 0x4A, 0x07, 0x4A,
+0xEC, 0x51, 0xC4, 0x51, 0xE4, 0x52, 0x05, 0x52, 0x48, 0x52, 0x8A, 0x53, 0x2D, 0x5A, 0x68, 0x5A,
+0x88, 0x5A, 0xAA, 0x5B, 0x2C, 0x5B, 0x4E, 0x5B, 0x6E, 0x62, 0x88, 0x62, 0xA9, 0x62, 0xEA, 0x63,
+0x0B, 0x63, 0x2C, 0x63, 0x2D, 0x63, 0x4D, 0x63, 0xD0, 0x6B, 0x2B, 0x6B, 0x4C, 0x6B, 0x6C, 0x6B,
+0x6D, 0x6B, 0xCF, 0x73, 0x4B, 0x73, 0x8D, 0x73, 0xAE, 0x7B, 0xEF, 0x83, 0xAD, 0x84, 0x2F, 0x8C,
+0x92, 0x94, 0xF3, 0x95, 0x98, 0x95, 0xB9, 0x9D, 0x14, 0x9D, 0x34, 0x9D, 0x35, 0x9D, 0x54, 0x9D,
+0x97, 0x9D, 0xB7, 0x9D, 0xD9, 0xA5, 0xB8, 0xAD, 0xD7, 0xAE, 0x3A, 0xBE, 0x59, 0xBE, 0x5A, 0xCE,
+0xFC, 0x95, 0x02, 0x02, 0x01, 0x07, 0x01, 0x94, 0x02, 0x94, 0x01, 0x04, 0x00, 0x3A, 0x36, 0x01,
+0x06, 0x93, 0x01, 0x93, 0x00, 0x02, 0x01, 0x39, 0x40, 0x80, 0x08, 0x01, 0x01, 0x06, 0xA7, 0x00,
+0x01, 0x01, 0x1E, 0x81, 0x08, 0x01, 0x5B, 0x0C, 0xA7, 0x00, 0x06, 0x06, 0x3A, 0x21, 0x3E, 0x42,
+0x71, 0x06, 0xA6, 0x00, 0x07, 0x06, 0x21, 0x25, 0x4D, 0x53, 0x52, 0x25, 0x06, 0xA6, 0x00, 0x01,
+0x1E, 0x3D, 0x83, 0x08, 0x01, 0x36, 0x0C, 0xA4, 0x00, 0x01, 0x06, 0x21, 0x83, 0x08, 0x02, 0x3C,
+0x01, 0x39, 0xA4, 0x00, 0x0A, 0x69, 0x2E, 0x08, 0x2E, 0x3F, 0x2F, 0x25, 0x41, 0x08, 0x44, 0x0A,
+0xA0, 0x00, 0x0C, 0x07, 0x0C, 0x0A, 0x09, 0x58, 0x64, 0x61, 0x55, 0x57, 0x5F, 0x51, 0x47, 0x2F,
+0x80, 0x06, 0x9E, 0x00, 0x08, 0x0E, 0x06, 0x62, 0x27, 0x12, 0x35, 0x1B, 0x27, 0x4A, 0x82, 0x16,
+0x03, 0x4F, 0x1D, 0x0A, 0x06, 0x9B, 0x00, 0x05, 0x07, 0x0A, 0x1D, 0x12, 0x1B, 0x27, 0x81, 0x04,
+0x01, 0x1C, 0x1A, 0x83, 0x03, 0x03, 0x23, 0x03, 0x0B, 0x0A, 0x92, 0x00, 0x03, 0x01, 0x00, 0x06,
+0x0C, 0x80, 0x00, 0x00, 0x06, 0x80, 0x0E, 0x01, 0x54, 0x12, 0x84, 0x04, 0x01, 0x1C, 0x1A, 0x85,
+0x03, 0x04, 0x19, 0x56, 0x2C, 0x0C, 0x06, 0x80, 0x00, 0x03, 0x0C, 0x06, 0x00, 0x01, 0x88, 0x00,
+0x00, 0x06, 0x80, 0x0A, 0x07, 0x2A, 0x20, 0x2C, 0x0A, 0x09, 0x5A, 0x24, 0x35, 0x85, 0x04, 0x01,
+0x1C, 0x1A, 0x86, 0x03, 0x07, 0x23, 0x46, 0x59, 0x09, 0x0A, 0x2C, 0x20, 0x21, 0x80, 0x0A, 0x00,
+0x06, 0x85, 0x00, 0x04, 0x07, 0x0E, 0x0F, 0x50, 0x31, 0x80, 0x14, 0x05, 0x33, 0x24, 0x26, 0x29,
+0x1E, 0x1B, 0x85, 0x04, 0x01, 0x1C, 0x1A, 0x85, 0x03, 0x06, 0x45, 0x4E, 0x6A, 0x29, 0x26, 0x24,
+0x26, 0x80, 0x14, 0x04, 0x31, 0x4C, 0x28, 0x0C, 0x06, 0x83, 0x00, 0x03, 0x06, 0x30, 0x14, 0x1F,
+0x80, 0x15, 0x07, 0x1F, 0x4B, 0x1E, 0x0E, 0x06, 0x0E, 0x5D, 0x1B, 0x84, 0x04, 0x01, 0x1C, 0x1A,
+0x85, 0x03, 0x07, 0x23, 0x18, 0x0C, 0x06, 0x0E, 0x1E, 0x33, 0x1F, 0x80, 0x15, 0x04, 0x1F, 0x14,
+0x30, 0x01, 0x07, 0x82, 0x00, 0x00, 0x0A, 0x83, 0x0D, 0x02, 0x32, 0x60, 0x0C, 0x80, 0x00, 0x02,
+0x07, 0x02, 0x34, 0x84, 0x04, 0x02, 0x1B, 0x48, 0x16, 0x84, 0x03, 0x01, 0x16, 0x0A, 0x81, 0x00,
+0x02, 0x0C, 0x28, 0x32, 0x82, 0x0D, 0x01, 0x15, 0x0E, 0x83, 0x00, 0x01, 0x07, 0x2A, 0x83, 0x05,
+0x01, 0x2B, 0x06, 0x80, 0x00, 0x03, 0x01, 0x0E, 0x5E, 0x34, 0x82, 0x12, 0x04, 0x49, 0x65, 0x2D,
+0x5C, 0x15, 0x82, 0x19, 0x03, 0x43, 0x28, 0x07, 0x01, 0x80, 0x00, 0x01, 0x06, 0x2B, 0x83, 0x05,
+0x00, 0x2A, 0x84, 0x00, 0x02, 0x07, 0x09, 0x22, 0x83, 0x05, 0x06, 0x09, 0x01, 0x00, 0x06, 0x70,
+0x6F, 0x66, 0x80, 0x2D, 0x11, 0x68, 0x3B, 0x6E, 0x77, 0x75, 0x6D, 0x76, 0x73, 0x6C, 0x3B, 0x6B,
+0x67, 0x74, 0x72, 0x06, 0x00, 0x01, 0x09, 0x83, 0x05, 0x02, 0x22, 0x09, 0x07, 0x84, 0x00, 0x07,
+0x07, 0x06, 0x07, 0x02, 0x09, 0x2B, 0x00, 0x02, 0x80, 0x09, 0x02, 0x02, 0x07, 0x1D, 0x82, 0x18,
+0x80, 0x1D, 0x03, 0x63, 0x20, 0x17, 0x20, 0x83, 0x17, 0x02, 0x10, 0x00, 0x02, 0x80, 0x09, 0x07,
+0x02, 0x07, 0x38, 0x09, 0x02, 0x07, 0x06, 0x07, 0x89, 0x00, 0x80, 0x07, 0x83, 0x00, 0x01, 0x22,
+0x37, 0x85, 0x13, 0x00, 0x37, 0x85, 0x0F, 0x00, 0x18, 0x80, 0x01, 0x82, 0x00, 0x80, 0x07, 0x93,
+0x00, 0x00, 0x06, 0x88, 0x0B, 0x85, 0x10, 0x02, 0x29, 0x38, 0x07, 0x99, 0x00, 0x01, 0x01, 0x05,
+0x86, 0x11, 0x87, 0x05, 0x01, 0x22, 0x06, 0x8C, 0x00,
+};
+
+static const unsigned char Boat_1_0[122] = {
+0x1B, 0x85, 0x16, 0x7C, 0x72, 0x41, 0xA5, 0x7C, 0x93, 0x84, 0xD4, 0x95, 0xB8, 0x39, 0x23, 0x8D,
+0x36, 0x39, 0x64, 0x41, 0x84, 0x7C, 0x52, 0x85, 0x15, 0x85, 0x36, 0x8D, 0x56, 0x30, 0xE2, 0x39,
+0x43, 0x41, 0x85, 0x49, 0xE6, 0x52, 0x48, 0x52, 0x69, 0x52, 0x89, 0x5A, 0xAA, 0x63, 0x4D, 0x6B,
+0x8E, 0x6B, 0xCF, 0x74, 0x10, 0x74, 0x31, 0x8D, 0x57, 0x80, 0x00, 0x03, 0x0B, 0x00, 0x0A, 0x17,
+0x80, 0x00, 0x05, 0x07, 0x16, 0x00, 0x19, 0x15, 0x0F, 0x80, 0x06, 0x06, 0x13, 0x11, 0x14, 0x1A,
+0x0E, 0x06, 0x08, 0x80, 0x09, 0x01, 0x08, 0x12, 0x81, 0x05, 0x83, 0x02, 0x05, 0x10, 0x18, 0x05,
+0x1B, 0x07, 0x0A, 0x83, 0x01, 0x80, 0x0D, 0x80, 0x00, 0x80, 0x0C, 0x83, 0x01, 0x00, 0x07, 0x80,
+0x00, 0x00, 0x04, 0x82, 0x03, 0x81, 0x04, 0x01, 0x0B, 0x00,
+};
+
+static const unsigned char Boat_1_1[131] = {
+0x1B, 0x85, 0x16, 0x7C, 0x72, 0x84, 0xD4, 0x8D, 0x36, 0x41, 0xA5, 0x95, 0xB9, 0x39, 0x23, 0x41,
+0x84, 0x7C, 0x93, 0x85, 0x15, 0x8D, 0x56, 0x39, 0x64, 0x52, 0x89, 0x73, 0xF0, 0x30, 0xE2, 0x39,
+0x43, 0x41, 0x85, 0x49, 0x84, 0x49, 0xE6, 0x4A, 0x07, 0x52, 0x69, 0x52, 0x8A, 0x63, 0x2D, 0x6B,
+0x8E, 0x74, 0x31, 0x7C, 0x52, 0x8D, 0x57, 0x95, 0xB8, 0x02, 0x13, 0x16, 0x03, 0x80, 0x00, 0x03,
+0x17, 0x03, 0x00, 0x09, 0x80, 0x00, 0x04, 0x11, 0x18, 0x0C, 0x12, 0x0C, 0x80, 0x06, 0x03, 0x0F,
+0x15, 0x0D, 0x00, 0x82, 0x05, 0x01, 0x14, 0x0B, 0x80, 0x07, 0x08, 0x0B, 0x06, 0x0E, 0x0A, 0x03,
+0x1A, 0x1B, 0x0D, 0x10, 0x82, 0x04, 0x00, 0x07, 0x81, 0x00, 0x80, 0x0A, 0x83, 0x01, 0x01, 0x19,
+0x09, 0x80, 0x00, 0x00, 0x03, 0x83, 0x01, 0x80, 0x00, 0x02, 0x03, 0x00, 0x09, 0x82, 0x02, 0x81,
+0x08, 0x00, 0x02,
+};
+
+static const unsigned char Boat_2_0[120] = {
+0x1B, 0x85, 0x16, 0x7C, 0x72, 0x41, 0xA5, 0x95, 0xB8, 0x7C, 0xB3, 0x39, 0x23, 0x85, 0x36, 0x8D,
+0x77, 0x39, 0x64, 0x41, 0x84, 0x7C, 0x52, 0x84, 0xD4, 0x8D, 0x36, 0x30, 0xE2, 0x39, 0x43, 0x41,
+0x85, 0x49, 0xE6, 0x52, 0x48, 0x52, 0x69, 0x52, 0x89, 0x5A, 0xAA, 0x63, 0x4D, 0x6B, 0x8E, 0x6B,
+0xCF, 0x74, 0x10, 0x74, 0x31, 0x8D, 0x56, 0x8D, 0x57, 0x82, 0x00, 0x01, 0x0A, 0x16, 0x81, 0x00,
+0x04, 0x15, 0x00, 0x18, 0x14, 0x0E, 0x80, 0x05, 0x06, 0x12, 0x10, 0x13, 0x19, 0x0D, 0x05, 0x08,
+0x80, 0x09, 0x02, 0x08, 0x11, 0x07, 0x80, 0x0B, 0x83, 0x02, 0x01, 0x0F, 0x17, 0x81, 0x03, 0x00,
+0x0A, 0x83, 0x01, 0x80, 0x03, 0x01, 0x1B, 0x0C, 0x80, 0x07, 0x83, 0x01, 0x00, 0x1A, 0x80, 0x00,
+0x81, 0x06, 0x82, 0x04, 0x00, 0x0C, 0x80, 0x00,
+};
+
+static const unsigned char Boat_2_1[132] = {
+0x1D, 0x85, 0x16, 0x7C, 0x72, 0x41, 0xA5, 0x7C, 0xB3, 0x95, 0xB9, 0x39, 0x23, 0x41, 0x84, 0x8D,
+0x57, 0x39, 0x64, 0x52, 0x89, 0x73, 0xF0, 0x84, 0xD4, 0x8D, 0x36, 0x8D, 0x56, 0x95, 0xB8, 0x30,
+0xE2, 0x39, 0x43, 0x41, 0x85, 0x49, 0x84, 0x49, 0xE6, 0x4A, 0x07, 0x52, 0x69, 0x52, 0x8A, 0x63,
+0x2D, 0x6B, 0x8E, 0x74, 0x31, 0x7C, 0x52, 0x85, 0x15, 0x8D, 0x77, 0x8D, 0x98, 0x01, 0x14, 0x17,
+0x81, 0x00, 0x00, 0x18, 0x83, 0x00, 0x04, 0x1D, 0x19, 0x09, 0x13, 0x09, 0x80, 0x05, 0x04, 0x10,
+0x16, 0x0A, 0x00, 0x12, 0x80, 0x0B, 0x02, 0x1C, 0x15, 0x08, 0x80, 0x06, 0x02, 0x08, 0x05, 0x0F,
+0x82, 0x04, 0x01, 0x0A, 0x11, 0x82, 0x02, 0x03, 0x06, 0x0D, 0x0C, 0x07, 0x80, 0x0E, 0x83, 0x01,
+0x00, 0x1A, 0x81, 0x00, 0x00, 0x0D, 0x83, 0x01, 0x80, 0x07, 0x00, 0x1B, 0x80, 0x00, 0x00, 0x0C,
+0x82, 0x03, 0x81, 0x00,
+};
+
+static const unsigned char Boat_3_0[109] = {
+0x19, 0x85, 0x16, 0x7C, 0x72, 0x41, 0xA5, 0x95, 0xB8, 0x39, 0x23, 0x8D, 0x36, 0x39, 0x64, 0x41,
+0x84, 0x7C, 0x52, 0x85, 0x36, 0x8D, 0x56, 0x30, 0xE2, 0x39, 0x43, 0x41, 0x85, 0x49, 0xE6, 0x52,
+0x48, 0x52, 0x69, 0x52, 0x89, 0x5A, 0xAA, 0x63, 0x4D, 0x6B, 0x8E, 0x6B, 0xCF, 0x74, 0x10, 0x74,
+0x31, 0x85, 0x15, 0x8D, 0x57, 0x8A, 0x00, 0x03, 0x18, 0x00, 0x08, 0x14, 0x80, 0x00, 0x05, 0x05,
+0x13, 0x00, 0x16, 0x12, 0x0C, 0x80, 0x04, 0x06, 0x10, 0x0E, 0x11, 0x17, 0x0B, 0x04, 0x06, 0x80,
+0x07, 0x01, 0x06, 0x0F, 0x81, 0x03, 0x83, 0x02, 0x05, 0x0D, 0x15, 0x03, 0x19, 0x05, 0x08, 0x83,
+0x01, 0x80, 0x0A, 0x80, 0x00, 0x80, 0x09, 0x83, 0x01, 0x00, 0x05, 0x80, 0x00,
+};
+
+static const unsigned char Boat_3_1[119] = {
+0x19, 0x85, 0x16, 0x7C, 0x72, 0x41, 0xA5, 0x8D, 0x36, 0x95, 0xB9, 0x39, 0x23, 0x41, 0x84, 0x8D,
+0x56, 0x39, 0x64, 0x52, 0x89, 0x73, 0xF0, 0x85, 0x15, 0x30, 0xE2, 0x39, 0x43, 0x41, 0x85, 0x49,
+0x84, 0x49, 0xE6, 0x4A, 0x07, 0x52, 0x69, 0x52, 0x8A, 0x63, 0x2D, 0x6B, 0x8E, 0x74, 0x31, 0x7C,
+0x52, 0x8D, 0x57, 0x95, 0xB8, 0x89, 0x00, 0x02, 0x11, 0x14, 0x03, 0x80, 0x00, 0x03, 0x15, 0x03,
+0x00, 0x0B, 0x80, 0x00, 0x04, 0x0F, 0x16, 0x09, 0x10, 0x09, 0x80, 0x05, 0x03, 0x0D, 0x13, 0x0A,
+0x00, 0x82, 0x04, 0x01, 0x12, 0x08, 0x80, 0x06, 0x08, 0x08, 0x05, 0x0C, 0x07, 0x03, 0x18, 0x19,
+0x0A, 0x0E, 0x82, 0x02, 0x00, 0x06, 0x81, 0x00, 0x80, 0x07, 0x83, 0x01, 0x01, 0x17, 0x0B, 0x80,
+0x00, 0x00, 0x03, 0x83, 0x01, 0x80, 0x00,
+};
+
+static const unsigned char Boat_4_0[132] = {
+0x1D, 0x85, 0x16, 0x7C, 0x72, 0x41, 0xA5, 0x8D, 0x36, 0x39, 0x23, 0x84, 0xD4, 0x8D, 0x57, 0x8D,
+0x77, 0x39, 0x64, 0x41, 0x84, 0x7C, 0x52, 0x85, 0x15, 0x8D, 0x56, 0x30, 0xE2, 0x39, 0x43, 0x41,
+0x85, 0x49, 0xE6, 0x52, 0x48, 0x52, 0x69, 0x52, 0x89, 0x5A, 0xAA, 0x63, 0x4D, 0x6B, 0x8E, 0x6B,
+0xCF, 0x74, 0x10, 0x74, 0x31, 0x7C, 0x93, 0x7C, 0xB3, 0x8D, 0x98, 0x95, 0xB8, 0x80, 0x00, 0x03,
+0x0B, 0x00, 0x03, 0x0C, 0x80, 0x00, 0x03, 0x03, 0x06, 0x00, 0x03, 0x80, 0x07, 0x09, 0x0A, 0x16,
+0x1C, 0x07, 0x05, 0x15, 0x06, 0x18, 0x14, 0x0E, 0x80, 0x04, 0x06, 0x12, 0x10, 0x13, 0x19, 0x0D,
+0x04, 0x08, 0x80, 0x09, 0x04, 0x08, 0x11, 0x1D, 0x06, 0x03, 0x83, 0x02, 0x02, 0x0F, 0x17, 0x0C,
+0x80, 0x00, 0x00, 0x0A, 0x83, 0x01, 0x01, 0x1B, 0x03, 0x80, 0x00, 0x01, 0x05, 0x1A, 0x83, 0x01,
+0x02, 0x05, 0x0B, 0x00,
+};
+
+static const unsigned char Boat_4_1[143] = {
+0x1E, 0x85, 0x16, 0x7C, 0x72, 0x8D, 0x36, 0x8D, 0x56, 0x41, 0xA5, 0x39, 0x23, 0x41, 0x84, 0x84,
+0xD4, 0x85, 0x15, 0x8D, 0x77, 0x39, 0x64, 0x52, 0x89, 0x73, 0xF0, 0x8D, 0x98, 0x30, 0xE2, 0x39,
+0x43, 0x41, 0x85, 0x49, 0xE6, 0x4A, 0x07, 0x52, 0x69, 0x52, 0x8A, 0x63, 0x2D, 0x6B, 0x8E, 0x74,
+0x31, 0x74, 0x52, 0x7C, 0x52, 0x7C, 0x93, 0x7C, 0xB3, 0x8D, 0x57, 0x95, 0xB8, 0x95, 0xB9, 0x02,
+0x0D, 0x03, 0x02, 0x80, 0x00, 0x03, 0x03, 0x02, 0x00, 0x08, 0x80, 0x00, 0x06, 0x12, 0x15, 0x07,
+0x09, 0x0D, 0x16, 0x18, 0x80, 0x09, 0x06, 0x02, 0x00, 0x1E, 0x17, 0x0B, 0x11, 0x0B, 0x80, 0x05,
+0x02, 0x0F, 0x14, 0x0C, 0x80, 0x03, 0x04, 0x02, 0x1C, 0x1D, 0x13, 0x0A, 0x80, 0x06, 0x02, 0x0A,
+0x05, 0x0E, 0x81, 0x00, 0x02, 0x03, 0x0C, 0x10, 0x82, 0x04, 0x01, 0x06, 0x08, 0x80, 0x00, 0x01,
+0x02, 0x1B, 0x83, 0x01, 0x04, 0x19, 0x02, 0x00, 0x08, 0x07, 0x83, 0x01, 0x01, 0x1A, 0x07,
+};
+
+static const AnimRect Boat_rects[9] = {
+	{0, 0, 48, 23, IMG_CODEC_PAL8, 761, Boat_0_0},
+	{3, 12, 10, 7, IMG_CODEC_PAL8, 122, Boat_1_0},
+	{33, 12, 11, 7, IMG_CODEC_PAL8, 131, Boat_1_1},
+	{3, 11, 10, 7, IMG_CODEC_PAL8, 120, Boat_2_0},
+	{33, 11, 11, 7, IMG_CODEC_PAL8, 132, Boat_2_1},
+	{3, 11, 10, 7, IMG_CODEC_PAL8, 109, Boat_3_0},
+	{33, 11, 11, 7, IMG_CODEC_PAL8, 119, Boat_3_1},
+	{3, 12, 10, 7, IMG_CODEC_PAL8, 132, Boat_4_0},
+	{33, 12, 11, 7, IMG_CODEC_PAL8, 143, Boat_4_1},
+};
+
+static const unsigned char Boat_steps[5] = {1, 2, 2, 2, 2};
+
+const Anim Boat = {48, 23, 4, 200, Boat_rects, Boat_steps};
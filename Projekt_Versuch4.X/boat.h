@@ -0,0 +1,15 @@
+/* generated by tools/imgconv from boat0.png .. boat3.png - do not edit */
+#ifndef _BOAT_H_
+
+#define _BOAT_H_
+
+#include "anim.h"
+
+#define BOAT_WIDTH 48
+#define BOAT_HEIGHT 23
+#define BOAT_FRAMES 4
+#define BOAT_PERIOD_MS 200
+
+extern const Anim Boat;
+
+#endif
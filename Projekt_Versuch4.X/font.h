@@ -0,0 +1,20 @@
+#ifndef _FONT_H_
+
+#define _FONT_H_
+
+#include <stdint.h>
+
+// 1 bit per pixel font, const in flash. Every glyph is width bytes, one per
+// column from left to right, bit 0 is the top row (up to 8 rows).
+// Characters outside first .. first + count - 1 are drawn blank.
+typedef struct
+{
+	uint8_t width, height; // glyph size in pixels
+	uint8_t spacing;	   // empty columns after every glyph
+	uint8_t first, count;  // character codes in the table
+	const uint8_t *glyphs;
+} Font;
+
+extern const Font Font5x7; // ASCII 0x20 .. 0x7E, cell 6 x 8
+
+#endif
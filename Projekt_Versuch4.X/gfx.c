@@ -0,0 +1,379 @@
+#include "hal.h"
+#include "display.h"
+#include "gfx.h"
+
+// Vector primitives on top of the display window registers.
+// Every shape is broken into spans: a run of pixels in one row or one
+// column, or a block of equal rows. A span goes out as one window (6
+// command words) plus one Display_RepeatColour burst, all spans of a shape in one
+// SPI transaction. A span right below the previous one with the same
+// columns is merged into it, so straight edges and axis aligned parts cost
+// a single window instead of one per row or pixel.
+// Coordinates are signed, spans are clipped to the screen.
+
+static uint16_t gfx_colour;
+static int16_t span_x, span_y, span_w, span_h; // pending span, span_w == 0: none
+
+// send the pending span
+static void Gfx_flush(void)
+{
+	int16_t x1 = span_x, y1 = span_y;
+	int16_t x2 = span_x + span_w, y2 = span_y + span_h;
+
+	if (!span_w)
+		return;
+	span_w = 0;
+	if (x1 < 0)
+		x1 = 0;
+	if (y1 < 0)
+		y1 = 0;
+	if (x2 > DISPLAY_WIDTH)
+		x2 = DISPLAY_WIDTH;
+	if (y2 > DISPLAY_HEIGHT)
+		y2 = DISPLAY_HEIGHT;
+	if (x1 >= x2 || y1 >= y2)
+		return;
+	Display_OpenWindow(x1, y1, x2 - x1, y2 - y1);
+	Display_RepeatColour(gfx_colour, (uint16_t)(x2 - x1) * (y2 - y1));
+}
+
+// queue the span x..x+w-1, y..y+h-1
+static void Gfx_span(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	if (w <= 0 || h <= 0)
+		return;
+	if (span_w && x == span_x && w == span_w && y == span_y + span_h)
+	{
+		span_h += h;
+		return;
+	}
+	Gfx_flush();
+	span_x = x;
+	span_y = y;
+	span_w = w;
+	span_h = h;
+}
+
+static void Gfx_begin(uint16_t colour)
+{
+	gfx_colour = colour;
+	span_w = 0;
+	SPI_begin();
+}
+
+static void Gfx_end(void)
+{
+	Gfx_flush();
+	SPI_end();
+}
+
+// Bresenham. A flat line (|dx| >= |dy|) is a row span per y step, a steep
+// one a column span per x step, horizontal and vertical lines are one span.
+static void Gfx_lineSpans(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+	int16_t dx = x1 - x0, dy = y1 - y0, t, err, step, start;
+
+	if (dx < 0)
+		dx = -dx;
+	if (dy < 0)
+		dy = -dy;
+	if (dx >= dy)
+	{
+		if (x0 > x1) // left to right
+		{
+			t = x0, x0 = x1, x1 = t;
+			t = y0, y0 = y1, y1 = t;
+		}
+		step = (y1 > y0) ? 1 : -1;
+		err = dx / 2;
+		for (start = x0; x0 <= x1; x0++)
+		{
+			err -= dy;
+			if (err < 0) // y changes after this pixel
+			{
+				Gfx_span(start, y0, x0 - start + 1, 1);
+				start = x0 + 1;
+				y0 += step;
+				err += dx;
+			}
+		}
+		Gfx_span(start, y0, x1 - start + 1, 1);
+	}
+	else
+	{
+		if (y0 > y1) // top to bottom
+		{
+			t = x0, x0 = x1, x1 = t;
+			t = y0, y0 = y1, y1 = t;
+		}
+		step = (x1 > x0) ? 1 : -1;
+		err = dy / 2;
+		for (start = y0; y0 <= y1; y0++)
+		{
+			err -= dx;
+			if (err < 0)
+			{
+				Gfx_span(x0, start, 1, y0 - start + 1);
+				start = y0 + 1;
+				x0 += step;
+				err += dy;
+			}
+		}
+		Gfx_span(x0, start, 1, y1 - start + 1);
+	}
+}
+
+void Gfx_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t colour)
+{
+	Gfx_begin(colour);
+	Gfx_lineSpans(x0, y0, x1, y1);
+	Gfx_end();
+}
+
+void Gfx_Rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour)
+{
+	if (w <= 0 || h <= 0)
+		return;
+	Gfx_begin(colour);
+	Gfx_span(x, y, w, 1);
+	Gfx_span(x, y + 1, 1, h - 2);
+	if (w > 1)
+		Gfx_span(x + w - 1, y + 1, 1, h - 2);
+	if (h > 1)
+		Gfx_span(x, y + h - 1, w, 1);
+	Gfx_end();
+}
+
+void Gfx_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour)
+{
+	Gfx_begin(colour);
+	Gfx_span(x, y, w, h);
+	Gfx_end();
+}
+
+// Ellipses and rounded rectangles are four quadrants around the centres
+// cxl/cxr (left/right) and cyt/cyb (top/bottom), equal for an ellipse.
+static int16_t arc_cxl, arc_cxr, arc_cyt, arc_cyb;
+static uint8_t arc_fill;
+
+// columns lo..hi (distance from the centres) of rows y..y+h-1, both sides
+static void Gfx_arcColumns(int16_t y, int16_t h, int16_t lo, int16_t hi)
+{
+	if (lo == 0) // the row is closed from left to right
+	{
+		Gfx_span(arc_cxl - hi, y, arc_cxr - arc_cxl + 2 * hi + 1, h);
+		return;
+	}
+	Gfx_span(arc_cxl - hi, y, hi - lo + 1, h);
+	Gfx_span(arc_cxr + lo, y, hi - lo + 1, h);
+}
+
+// Rows d0..d1 above and below the centres, all with the run lo..hi.
+// The group with row 0 also covers the rows between the centres. For a
+// rounded rectangle (rx == ry >= 1) its outline run is one column, as
+// half(1) == half(0).
+static void Gfx_arcRows(uint8_t d0, uint8_t d1, int16_t lo, int16_t hi)
+{
+	int16_t n = d1 - d0 + 1;
+
+	if (d0 == 0) // one block from the top through the middle to the bottom
+	{
+		Gfx_arcColumns(arc_cyt - d1, arc_cyb - arc_cyt + 2 * d1 + 1, lo, hi);
+		return;
+	}
+	Gfx_arcColumns(arc_cyt - d1, n, lo, hi);
+	Gfx_arcColumns(arc_cyb + d0, n, lo, hi);
+}
+
+// half(dy) is the half width of row dy: the last x with
+// x^2 / (rx + 0.5)^2 + dy^2 / (ry + 0.5)^2 <= 1, i.e. the pixel centres
+// inside the ellipse grown by half a pixel (the midpoint circle for rx == ry).
+// An outline row covers half(dy + 1) + 1 .. half(dy), at least one pixel.
+// Rows with the same run are one span, so the steep parts of the outline
+// become column spans and the flat parts row spans.
+// With radii up to 127 all products fit into 32 bits.
+static void Gfx_arc(uint8_t rx, uint8_t ry)
+{
+	uint32_t a = (uint32_t)(2 * ry + 1) * (2 * ry + 1);
+	uint32_t b = (uint32_t)(2 * rx + 1) * (2 * rx + 1);
+	uint32_t ab = a * b;
+	int16_t x = rx, hi = rx, next, lo, group_lo = 0, group_hi = 0;
+	uint8_t dy, d0 = 0;
+
+	for (dy = 0; dy <= ry; dy++)
+	{
+		if (dy < ry)
+		{
+			while (x > 0 && 4 * (uint32_t)x * x * a > ab - 4 * (uint32_t)(dy + 1) * (dy + 1) * b)
+				x--;
+			next = x;
+		}
+		else
+			next = -1;
+		if (arc_fill)
+			lo = 0;
+		else if (next + 1 < hi)
+			lo = next + 1;
+		else
+			lo = hi;
+		if (dy == 0)
+		{
+			group_lo = lo;
+			group_hi = hi;
+		}
+		else if (lo != group_lo || hi != group_hi)
+		{
+			Gfx_arcRows(d0, dy - 1, group_lo, group_hi);
+			d0 = dy;
+			group_lo = lo;
+			group_hi = hi;
+		}
+		hi = next;
+	}
+	Gfx_arcRows(d0, ry, group_lo, group_hi);
+}
+
+static void Gfx_ellipse(int16_t cx, int16_t cy, uint8_t rx, uint8_t ry, uint8_t fill, uint16_t colour)
+{
+	if (rx > GFX_RADIUS_MAX)
+		rx = GFX_RADIUS_MAX;
+	if (ry > GFX_RADIUS_MAX)
+		ry = GFX_RADIUS_MAX;
+	arc_cxl = arc_cxr = cx;
+	arc_cyt = arc_cyb = cy;
+	arc_fill = fill;
+	Gfx_begin(colour);
+	Gfx_arc(rx, ry);
+	Gfx_end();
+}
+
+void Gfx_Circle(int16_t cx, int16_t cy, uint8_t r, uint16_t colour)
+{
+	Gfx_ellipse(cx, cy, r, r, 0, colour);
+}
+
+void Gfx_FillCircle(int16_t cx, int16_t cy, uint8_t r, uint16_t colour)
+{
+	Gfx_ellipse(cx, cy, r, r, 1, colour);
+}
+
+void Gfx_Ellipse(int16_t cx, int16_t cy, uint8_t rx, uint8_t ry, uint16_t colour)
+{
+	Gfx_ellipse(cx, cy, rx, ry, 0, colour);
+}
+
+void Gfx_FillEllipse(int16_t cx, int16_t cy, uint8_t rx, uint8_t ry, uint16_t colour)
+{
+	Gfx_ellipse(cx, cy, rx, ry, 1, colour);
+}
+
+static void Gfx_roundRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t r, uint8_t fill, uint16_t colour)
+{
+	if (w <= 0 || h <= 0)
+		return;
+	if (r > (w - 1) / 2) // corners must not overlap
+		r = (w - 1) / 2;
+	if (r > (h - 1) / 2)
+		r = (h - 1) / 2;
+	if (r == 0)
+	{
+		if (fill)
+			Gfx_FillRect(x, y, w, h, colour);
+		else
+			Gfx_Rect(x, y, w, h, colour);
+		return;
+	}
+	arc_cxl = x + r;
+	arc_cxr = x + w - 1 - r;
+	arc_cyt = y + r;
+	arc_cyb = y + h - 1 - r;
+	arc_fill = fill;
+	Gfx_begin(colour);
+	Gfx_arc(r, r);
+	Gfx_end();
+}
+
+void Gfx_RoundRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t r, uint16_t colour)
+{
+	Gfx_roundRect(x, y, w, h, r, 0, colour);
+}
+
+void Gfx_FillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t r, uint16_t colour)
+{
+	Gfx_roundRect(x, y, w, h, r, 1, colour);
+}
+
+void Gfx_Polygon(const GfxPoint *p, uint8_t n, uint16_t colour)
+{
+	uint8_t i;
+
+	if (n == 0)
+		return;
+	Gfx_begin(colour);
+	for (i = 0; i < n; i++)
+		Gfx_lineSpans(p[i].x, p[i].y, p[(i + 1) % n].x, p[(i + 1) % n].y);
+	Gfx_end();
+}
+
+// ceil(n / d) for d > 0
+static int16_t Gfx_ceilDiv(int32_t n, int32_t d)
+{
+	if (n >= 0)
+		return (n + d - 1) / d;
+	return -(-n / d);
+}
+
+// Scanline fill with the even-odd rule. Row y is sampled at its pixel
+// centres y + 0.5, a pixel is inside if its centre is, so a polygon
+// (0,0) (10,0) (10,10) (0,10) covers exactly 10 x 10 pixels and polygons
+// sharing an edge do not overlap. Equal rows (vertical edges) merge into
+// one span.
+void Gfx_FillPolygon(const GfxPoint *p, uint8_t n, uint16_t colour)
+{
+	int16_t xs[GFX_POLY_MAX];
+	int16_t y, y_min, y_max, x;
+	int32_t num, den;
+	uint8_t i, k, j;
+	const GfxPoint *a, *b, *t;
+
+	if (n > GFX_POLY_MAX)
+		n = GFX_POLY_MAX;
+	if (n < 3)
+		return;
+	y_min = y_max = p[0].y;
+	for (i = 1; i < n; i++)
+	{
+		if (p[i].y < y_min)
+			y_min = p[i].y;
+		if (p[i].y > y_max)
+			y_max = p[i].y;
+	}
+	if (y_min < 0)
+		y_min = 0;
+	if (y_max > DISPLAY_HEIGHT)
+		y_max = DISPLAY_HEIGHT;
+
+	Gfx_begin(colour);
+	for (y = y_min; y < y_max; y++)
+	{
+		for (i = 0, k = 0; i < n; i++)
+		{
+			a = &p[i];
+			b = &p[(i + 1) % n];
+			if (a->y > b->y)
+				t = a, a = b, b = t;
+			if (y < a->y || y >= b->y) // also skips horizontal edges
+				continue;
+			// first pixel right of the crossing a.x + num / den, sorted in
+			num = (int32_t)(2 * (y - a->y) + 1) * (b->x - a->x);
+			den = 2 * (int32_t)(b->y - a->y);
+			x = a->x + Gfx_ceilDiv(2 * num - den, 2 * den);
+			for (j = k++; j > 0 && xs[j - 1] > x; j--)
+				xs[j] = xs[j - 1];
+			xs[j] = x;
+		}
+		for (i = 0; i + 1 < k; i += 2)
+			Gfx_span(xs[i], y, xs[i + 1] - xs[i], 1);
+	}
+	Gfx_end();
+}
@@ -0,0 +1,27 @@
+#ifndef _GFX_H_
+
+#define _GFX_H_
+
+#include <stdint.h>
+
+#define GFX_POLY_MAX 16 // corners of a polygon, more are ignored
+#define GFX_RADIUS_MAX 127 // larger radii are cut down to this
+
+typedef struct
+{
+	int16_t x, y;
+} GfxPoint;
+
+void Gfx_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t colour);
+void Gfx_Rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour);
+void Gfx_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour);
+void Gfx_Circle(int16_t cx, int16_t cy, uint8_t r, uint16_t colour);
+void Gfx_FillCircle(int16_t cx, int16_t cy, uint8_t r, uint16_t colour);
+void Gfx_Ellipse(int16_t cx, int16_t cy, uint8_t rx, uint8_t ry, uint16_t colour);
+void Gfx_FillEllipse(int16_t cx, int16_t cy, uint8_t rx, uint8_t ry, uint16_t colour);
+void Gfx_RoundRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t r, uint16_t colour);
+void Gfx_FillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t r, uint16_t colour);
+void Gfx_Polygon(const GfxPoint *p, uint8_t n, uint16_t colour);
+void Gfx_FillPolygon(const GfxPoint *p, uint8_t n, uint16_t colour);
+
+#endif
@@ -0,0 +1,21 @@
+/* generated by tools/imgconv from gull.png - do not edit
+   Gull: 17 x 7 Pixel, 12 spans, 42 opaque pixels, 124 bytes */
+
+#include "gull.h"
+
+static const unsigned short Gull_rows[8] = {
+0x0000, 0x0002, 0x0004, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C,
+};
+
+static const unsigned char Gull_spans[24] = {
+0x02, 0x02, 0x0D, 0x02, 0x01, 0x04, 0x0C, 0x04, 0x00, 0x01, 0x04, 0x03, 0x0A, 0x03, 0x10, 0x01,
+0x06, 0x05, 0x05, 0x09, 0x06, 0x06, 0x08, 0x02,
+};
+
+static const unsigned short Gull_pixels[42] = {
+0x5ACC, 0x5ACC, 0x5ACC, 0x5ACC, 0x5ACC, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0x5ACC, 0x5ACC, 0xF7BE, 0xF7BE, 0xF7BE,
+0xF7BE, 0xF7BE, 0xF7BE, 0x5ACC, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0x5ACC, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE,
+0xED40, 0xED40, 0x5ACC, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0x5ACC, 0x5ACC, 0x5ACC,
+};
+
+const KeySprite Gull = {17, 7, Gull_rows, Gull_spans, Gull_pixels};
@@ -0,0 +1,13 @@
+/* generated by tools/imgconv from gull.png - do not edit */
+#ifndef _GULL_H_
+
+#define _GULL_H_
+
+#include "keysprite.h"
+
+#define GULL_WIDTH 17
+#define GULL_HEIGHT 7
+
+extern const KeySprite Gull;
+
+#endif
@@ -0,0 +1,200 @@
+#include "hal.h"
+#include "display.h"
+#include "keysprite.h"
+
+// Colour key sprites (tables in keysprite.h).
+// Every opaque span is one window with only its own pixels, transparent
+// pixels cost no bus time at all. Rows that consist of one span at the same
+// place as the row above are one window together, their pixels follow each
+// other in the table. The display cannot be read back, so a moving sprite
+// is erased with a background colour: KeySprite_move only clears the pixels
+// of the old position that the new one does not cover and draws the new one,
+// all in one SPI transaction.
+// Positions are signed, the sprite is clipped to the screen.
+
+static int16_t clear_x, clear_y, clear_w, clear_h; // pending background rectangle, clear_w == 0: none
+static uint16_t clear_colour;
+
+// n pixels of a table into the open window
+static void KeySprite_stream(const uint16_t *p, uint16_t n)
+{
+	HalFlash src = HAL_FLASH(p);
+
+	if (display_colours == DISPLAY_COLOURS_8)
+		while (n--)
+			Display_PutColour(HAL_ReadFlash16(&src));
+	else
+		SPIStream16Bit(p, n);
+}
+
+// w x h pixels of the table at p to (x, y), clipped to the screen
+static void KeySprite_block(int16_t x, int16_t y, uint8_t w, uint8_t h, const uint16_t *p)
+{
+	int16_t x1 = x, y1 = y, x2 = x + w, y2 = y + h;
+
+	if (x1 < 0)
+		x1 = 0;
+	if (y1 < 0)
+		y1 = 0;
+	if (x2 > DISPLAY_WIDTH)
+		x2 = DISPLAY_WIDTH;
+	if (y2 > DISPLAY_HEIGHT)
+		y2 = DISPLAY_HEIGHT;
+	if (x1 >= x2 || y1 >= y2)
+		return;
+	Display_OpenWindow(x1, y1, x2 - x1, y2 - y1);
+	p += (y1 - y) * w + (x1 - x);
+	if (x2 - x1 == w) // not cut on the sides: all rows in one go
+	{
+		KeySprite_stream(p, (uint16_t)w * (y2 - y1));
+		return;
+	}
+	for (; y1 < y2; y1++, p += w)
+		KeySprite_stream(p, x2 - x1);
+}
+
+// all opaque pixels of the sprite at (x, y) into the open transaction
+static void KeySprite_blocks(const KeySprite *s, int16_t x, int16_t y)
+{
+	const uint16_t *p = s->pixels;
+	const uint8_t *span;
+	uint8_t r, k;
+	uint16_t i;
+
+	for (r = 0; r < s->h; r = k)
+	{
+		i = s->rows[r];
+		span = s->spans + 2 * i;
+		k = r + 1;
+		if (s->rows[k] - i == 1) // single span: rows below with the same span join it
+		{
+			while (k < s->h && s->rows[k + 1] - s->rows[k] == 1 &&
+				   s->spans[2 * s->rows[k]] == span[0] && s->spans[2 * s->rows[k] + 1] == span[1])
+				k++;
+			KeySprite_block(x + span[0], y + r, span[1], k - r, p);
+			p += (uint16_t)span[1] * (k - r);
+			continue;
+		}
+		for (; i < s->rows[k]; i++, span += 2)
+		{
+			KeySprite_block(x + span[0], y + r, span[1], 1, p);
+			p += span[1];
+		}
+	}
+}
+
+// send the pending background rectangle
+static void KeySprite_flush(void)
+{
+	int16_t x1 = clear_x, y1 = clear_y, x2 = clear_x + clear_w, y2 = clear_y + clear_h;
+
+	if (!clear_w)
+		return;
+	clear_w = 0;
+	if (x1 < 0)
+		x1 = 0;
+	if (y1 < 0)
+		y1 = 0;
+	if (x2 > DISPLAY_WIDTH)
+		x2 = DISPLAY_WIDTH;
+	if (y2 > DISPLAY_HEIGHT)
+		y2 = DISPLAY_HEIGHT;
+	if (x1 >= x2 || y1 >= y2)
+		return;
+	Display_OpenWindow(x1, y1, x2 - x1, y2 - y1);
+	Display_RepeatColour(clear_colour, (uint16_t)(x2 - x1) * (y2 - y1));
+}
+
+// background for x..x+w-1 in row y; right below the pending rectangle with
+// the same columns it only grows that one
+static void KeySprite_clear(int16_t x, int16_t y, int16_t w)
+{
+	if (clear_w && x == clear_x && w == clear_w && y == clear_y + clear_h)
+	{
+		clear_h++;
+		return;
+	}
+	KeySprite_flush();
+	clear_x = x;
+	clear_y = y;
+	clear_w = w;
+	clear_h = 1;
+}
+
+// Background for the opaque pixels of s at (x0, y0) that are not opaque in
+// s at (x1, y1). The spans of both rows are sorted, so every old span is cut
+// by walking the new ones once.
+static void KeySprite_clearUncovered(const KeySprite *s, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+	const uint8_t *a, *b;
+	uint16_t i, j, jend;
+	int16_t cur, end, b0, b1;
+	uint8_t r;
+	int16_t q;
+
+	for (r = 0; r < s->h; r++)
+	{
+		q = y0 + r - y1; // same screen row in the new position
+		if (q >= 0 && q < s->h)
+		{
+			j = s->rows[q];
+			jend = s->rows[q + 1];
+		}
+		else
+			j = jend = 0;
+		for (i = s->rows[r]; i < s->rows[r + 1]; i++)
+		{
+			a = s->spans + 2 * i;
+			cur = x0 + a[0];
+			end = cur + a[1];
+			for (; j < jend; j++)
+			{
+				b = s->spans + 2 * j;
+				b0 = x1 + b[0];
+				b1 = b0 + b[1];
+				if (b1 <= cur)
+					continue;
+				if (b0 >= end)
+					break;
+				if (b0 > cur)
+					KeySprite_clear(cur, y0 + r, b0 - cur);
+				cur = b1;
+				if (cur >= end)
+					break;
+			}
+			if (cur < end)
+				KeySprite_clear(cur, y0 + r, end - cur);
+		}
+	}
+	KeySprite_flush();
+}
+
+// Draw the opaque pixels of s at (x, y), the transparent ones keep what is
+// on the screen
+void KeySprite_draw(const KeySprite *s, int16_t x, int16_t y)
+{
+	SPI_begin();
+	KeySprite_blocks(s, x, y);
+	SPI_end();
+}
+
+// Paint the opaque pixels of s at (x, y) with the background colour bg
+void KeySprite_erase(const KeySprite *s, int16_t x, int16_t y, uint16_t bg)
+{
+	clear_colour = bg;
+	clear_w = 0;
+	SPI_begin();
+	KeySprite_clearUncovered(s, x, y, x, y + s->h); // nothing covers it
+	SPI_end();
+}
+
+// Move s from (x0, y0) to (x1, y1) over a background of the colour bg
+void KeySprite_move(const KeySprite *s, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t bg)
+{
+	clear_colour = bg;
+	clear_w = 0;
+	SPI_begin();
+	KeySprite_clearUncovered(s, x0, y0, x1, y1);
+	KeySprite_blocks(s, x1, y1);
+	SPI_end();
+}
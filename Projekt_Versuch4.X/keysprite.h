@@ -0,0 +1,22 @@
+#ifndef _KEYSPRITE_H_
+
+#define _KEYSPRITE_H_
+
+#include <stdint.h>
+
+// Sprite with transparent pixels, generated by tools/imgconv -k from a
+// picture with a colour key. All tables are const in flash. Every row is a
+// list of opaque spans, the pixels of the colour key are not stored at all.
+typedef struct
+{
+	uint8_t w, h;
+	const uint16_t *rows;	// h + 1 entries: first span of every row, the last one is the number of spans
+	const uint8_t *spans;	// 2 bytes per span, x and length, left to right in the row
+	const uint16_t *pixels; // RGB565 of the opaque pixels, row by row, span by span
+} KeySprite;
+
+void KeySprite_draw(const KeySprite *s, int16_t x, int16_t y);
+void KeySprite_erase(const KeySprite *s, int16_t x, int16_t y, uint16_t bg);
+void KeySprite_move(const KeySprite *s, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t bg);
+
+#endif
@@ -1,192 +1,127 @@
 #define F_CPU 16000000UL
 #include <xc.h>
 #include <avr/interrupt.h>
+#include "hal.h"
+#include "display.h"
 #include "picture.h"
+#include "anim.h"
+#include "boat.h"
+#include "gull.h"
+#include "prof.h"
+#include "stream.h"
+#include "text.h"
+#include "timer.h"
+
+#define BOAT_X 18 // position of the boat animation in Bild1
+#define BOAT_Y 53
+
+#define GULL_MS 40 // the gull moves one pixel every GULL_MS
+#define GULL_Y 8   // above the picture
+
+#define STATUS_MS 100 // refresh of the status line
+#define STATUS_X 4	  // below the picture
+#define STATUS_Y (DISPLAY_HEIGHT - 12)
+
+// boot steps, separate functions so that tools/simbench times them by symbol
+void Boot_background(void) __attribute__((noinline));
+void Boot_picture(void) __attribute__((noinline));
+
+#if !STREAM
+static const TextStyle status_style = {&Font5x7, 0x0000, 0x7E0, 1}; // schwarz auf grün
+static TextField uptime; // seconds since the start, 0.1 s steps
+static volatile uint8_t status_due;
+static volatile uint8_t gull_due;
+
+// status tick (Timer1 interrupt)
+static void status_tick(void)
+{
+	status_due = 1;
+}
 
-// defining the text replacements
-#define SPI_DDR DDRB
-#define SS PINB2
-#define MOSI PINB3
-#define SCK PINB5
-#define D_C PIND2	// display: Data/Command
-#define Reset PIND3 // display: Reset
-
-volatile uint16_t counter;
-const uint16_t window[] = {0xEF08, 0x1805, 0x1267, 0x151C, 0x1312, 0x169D};
-
-void SPISend8Bit(uint8_t data);
-void SendCommandSeq(const uint16_t *data, uint32_t Anzahl);
-ISR(TIMER1_COMPA_vect);
-void Waitms(const uint16_t msWait);
-void init_Timer1();
-void SPI_init();
-void SPISend16Bit(uint16_t data);
-void Display_init(void);
+// gull tick (Timer1 interrupt)
+static void gull_tick(void)
+{
+	gull_due = 1;
+}
+#endif
 
 // main method
 int main(void)
 {
-	// initializing the variables
-	uint16_t i;						   // used for counting through for loop
-	uint16_t x;						   // used for moving through compressed picture data
-	uint32_t p;						   // used for counting through for loop
-	DDRD |= (1 << D_C) | (1 << Reset); // output: PD2 -> Data/Command; PD3 -> Reset
+#if !STREAM
+	char text[TEXT_FIELD_MAX + 1];
+	uint8_t x;
+	int16_t gull_x = -GULL_WIDTH, gull_y = GULL_Y;
+#endif
 
 	// calling the functions
 	init_Timer1();
+#if PROFILE
+	Prof_init();
+#endif
+#if STREAM
+	Stream_init();
+#endif
 	SPI_init();
 	sei();
 	Display_init();
 
-	// drawing the background
-	for (i = 0; i < 23232; i++) // 132*176 = 23232
-	{
-		SPISend16Bit(0x7E0); // grün
-	}
+	Boot_background();
+	Boot_picture();
+#if !STREAM
+	// the rower in the picture
+	Anim_play(&Boat, (DISPLAY_WIDTH - BILD1_WIDTH) / 2 + BOAT_X, (DISPLAY_HEIGHT - BILD1_HEIGHT) / 2 + BOAT_Y);
 
-	// drawing the sqare (in the place the image should be called)
-	SendCommandSeq(window, 6);
-	for (i = 0; i < 10640; i++) // 140*76 = 10640
-	{
-		SPISend16Bit(0xF800); // rot
-	}
+	// status line: "Laufzeit   12.3 s", only the changed digits are redrawn
+	x = STATUS_X + Text_draw(STATUS_X, STATUS_Y, "Laufzeit", &status_style);
+	TextField_init(&uptime, x, STATUS_Y, 7, &status_style);
+	TextField_set(&uptime, Text_formatFixed(text, 0, 1, 7));
+	Text_draw(x + 7 * Text_cellWidth(&status_style), STATUS_Y, " s", &status_style);
+	Timer_start(status_tick, STATUS_MS, STATUS_MS);
 
-	// logic for decoding and drawing the image
-	i = 0;
-	while (i < 2900)
+	// a gull flying over the green background, transparent around its wings
+	KeySprite_draw(&Gull, gull_x, gull_y);
+	Timer_start(gull_tick, GULL_MS, GULL_MS);
+#endif
+
+	// endless loop
+	while (1)
 	{
-		if (Bild1[i] == Bild1[i + 1])
+#if PROFILE
+		Prof_task(); // counters over UART
+#endif
+#if STREAM
+		Stream_run(); // next picture from the UART
+#else
+		Anim_task(); // next step of the animation when it is due
+		if (status_due)
 		{
-			x = Bild1[i + 2] + 2;
-			for (p = 0; p < x; p++)
-			{
-				SPISend16Bit(Bild1[i]);
-			}
-			i += 3;
+			status_due = 0;
+			// from the clock, a late status task must not slow it down
+			TextField_set(&uptime, Text_formatFixed(text, Timer_now() / 100, 1, 7));
 		}
-		else
+		if (gull_due)
 		{
-			SPISend16Bit(Bild1[i]);
-			i++;
+			int16_t nx = (gull_x >= DISPLAY_WIDTH) ? -GULL_WIDTH : gull_x + 1;
+			int16_t ny = GULL_Y + ((nx >> 4) & 1); // up and down every 16 pixels
+			gull_due = 0;
+			KeySprite_move(&Gull, gull_x, gull_y, nx, ny, 0x7E0);
+			gull_x = nx;
+			gull_y = ny;
 		}
+#endif
 	}
-
-	// endless loop
-	while (1)
-	{
-		;
-	}
-}
-
-// Timer1 interrupt service routine
-ISR(TIMER1_COMPA_vect)
-{
-	counter++;
-}
-
-// wait for msWait milliseconds function
-void Waitms(const uint16_t msWait)
-{
-	static uint16_t aktTime, diff;
-	uint16_t countertemp;
-	cli();			   // da 16 bit Variablen könnte ohne cli() sei() sich der Wert
-	aktTime = counter; // von counter ändern, bevor er komplett aktTime zugewiesen wird.
-	sei();			   // Zuweisung erfolgt wg. 8 bit controller in 2 Schritten.
-	do
-	{
-		cli(); // disables interrupts for a timed sequence
-		countertemp = counter;
-		sei();
-		diff = countertemp + ~aktTime + 1;
-	} while (diff < msWait);
 }
 
-// Timer1 interrupt service routine
-void init_Timer1()
+// drawing the background
+void Boot_background(void)
 {
-	TCCR1B |= (1 << CS10) | (1 << WGM12); // TimerCounter1ControlRegisterB Clock Select |(1<<CS10)=>prescaler = 1; WGM12=>CTC mode
-	TIMSK1 |= (1 << OCIE1A);			  // TimerCounter1 Interrupt Mask Register: Output Compare Overflow Interrupt Enable
-	OCR1A = 15999;						  // Aufloesung msec
+	Display_FillRect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, 0x7E0); // grün
 }
 
-// SPI initialization
-void SPI_init()
+// decoding and drawing the image (centered)
+void Boot_picture(void)
 {
-	// set CS, MOSI and SCK to output
-	SPI_DDR |= (1 << SS) | (1 << MOSI) | (1 << SCK);
-	// enable SPI, set as master, and clock to fosc/4 or 128
-	SPCR = (1 << SPE) | (1 << MSTR); //	4MHz bzw. 125kHz
+	Display_DrawImage((DISPLAY_WIDTH - BILD1_WIDTH) / 2, (DISPLAY_HEIGHT - BILD1_HEIGHT) / 2,
+					  BILD1_WIDTH, BILD1_HEIGHT, Bild1, BILD1_LENGTH, BILD1_CODEC);
 }
-
-// SPI send 8 bit
-void SPISend8Bit(uint8_t data)
-{
-	PORTB &= ~(1 << SS); // CS low
-	SPDR = data;		 // load data into register
-	while (!(SPSR & (1 << SPIF)))
-		;				// wait for transmission complete
-	PORTB |= (1 << SS); // CS high
-}
-
-// SPI send 16 bit
-void SPISend16Bit(uint16_t data)
-{
-	uint8_t SendeByte;
-	SendeByte = (data >> 8) & 0xFF; // High-Byte des Kommandos
-	SPISend8Bit(SendeByte);
-	SendeByte = data & 0xFF; // Low-Byte des Kommandos
-	SPISend8Bit(SendeByte);
-}
-
-// Send command sequence
-void SendCommandSeq(const uint16_t *data, uint32_t Anzahl)
-{
-	uint32_t index;
-	uint8_t SendeByte;
-	for (index = 0; index < Anzahl; index++)
-	{
-		PORTD |= (1 << D_C);				   // Data/Command auf High => Kommando-Modus
-		SendeByte = (data[index] >> 8) & 0xFF; // High-Byte des Kommandos
-		SPISend8Bit(SendeByte);
-		SendeByte = data[index] & 0xFF; // Low-Byte des Kommandos
-		SPISend8Bit(SendeByte);
-		PORTD &= ~(1 << D_C); // Data/Command auf Low => Daten-Modus
-	}
-}
-
-// Display initialization
-void Display_init(void)
-{
-	const uint16_t InitData[] = {
-		// Initialisierungsdaten fuer 16-Bit-Farben Modus
-		0xFDFD, 0xFDFD,
-		// pause
-		0xEF00, 0xEE04, 0x1B04, 0xFEFE, 0xFEFE,
-		0xEF90, 0x4A04, 0x7F3F, 0xEE04, 0x4306,
-		// pause
-		0xEF90, 0x0983, 0x0800, 0x0BAF, 0x0A00,
-		0x0500, 0x0600, 0x0700, 0xEF00, 0xEE0C,
-		0xEF90, 0x0080, 0xEFB0, 0x4902, 0xEF00,
-		0x7F01, 0xE181, 0xE202, 0xE276, 0xE183,
-		0x8001, 0xEF90, 0x0000,
-		// pause
-		0xEF08, 0x1805, 0x1283, 0x1500, 0x1300,
-		0x16AF // Querformat 176 x 132 Pixel
-	};
-	Waitms(300);
-	PORTD &= ~(1 << Reset); // Reset-Eingang des Displays auf Low => Beginn Hardware-Reset
-	Waitms(75);
-	PORTB |= (1 << SS); // SSEL auf High
-	Waitms(75);
-	PORTD |= (1 << D_C); // Data/Command auf High
-	Waitms(75);
-	PORTD |= (1 << Reset); // Reset-Eingang des Displays auf High => Ende Hardware Reset
-	Waitms(75);
-	SendCommandSeq(&InitData[0], 2);
-	Waitms(75);
-	SendCommandSeq(&InitData[2], 10);
-	Waitms(75);
-	SendCommandSeq(&InitData[12], 23);
-	Waitms(75);
-	SendCommandSeq(&InitData[35], 6);
-}
\ No newline at end of file
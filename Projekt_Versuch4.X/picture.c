@@ -1,190 +1,189 @@
-/* Das folgende Array Bild1[2904] enth�lt die komprimierten Farbdaten eines Bildes.
-   Das Bild hat eine Groesse von 140 x 76 Pixel	(X x Y).
-   Die Pixeldaten sind in der Tablelle komprimiert abgelegt. Zur Kompression
-   wurde die Methode per Farbwiederholung verwendet. */
-	 
-const unsigned short Bild1[2904] = {
+/* generated by tools/imgconv from Bild1.png - do not edit
+   Bild1: 140 x 76 Pixel, codec rle, 5802 bytes */
 
-0xCEFC, 0xCEFC, 0x05B7, 0xCF1C, 0xCF3D, 0xBEDB, 0xAE59, 0xAE79, 0xAE79, 0x0000, 0xAE59, 0xB69A, 0xCF5D, 0xCF1C, 0xCEFC, 0xCEFC, 
-0x007E, 0xCF3D, 0xAE79, 0xB679, 0xBC52, 0xCB0E, 0xDA4C, 0xD18A, 0xD18A, 0x0000, 0xDA2C, 0xD2EE, 0xBBF1, 0xBE38, 0xAE59, 0xCF3D, 
-0xCEFC, 0xCEFC, 0x007A, 0xCF1D, 0xB69A, 0xB5D7, 0xD2CE, 0xC804, 0xC003, 0xC004, 0xC004, 0x0004, 0xC003, 0xC003, 0x0000, 0xDA4C, 
-0xBD35, 0xAE79, 0xD73D, 0xCEFC, 0xCEFC, 0x0077, 0xCF3D, 0xA658, 0xD390, 0xC803, 0xC003, 0xC005, 0xC005, 0x0008, 0xC004, 0xC002, 
-0xD2AE, 0xAE18, 0xCF1C, 0xCEFC, 0xCEFC, 0x0075, 0xCF1D, 0xA5F7, 0xD98A, 0xC003, 0xC005, 0xC005, 0x000C, 0xC003, 0xD087, 0xB5B6, 
-0xC6FC, 0xCEFC, 0xCEFC, 0x0073, 0xD73D, 0xA5F7, 0xD108, 0xC003, 0xC005, 0xC005, 0x000E, 0xC004, 0xD005, 0xB5B6, 0xCF1C, 0xCEFC, 
-0xCEFC, 0x0071, 0xCF1C, 0xAE59, 0xD9CB, 0xC003, 0xC005, 0xC005, 0x0010, 0xC004, 0xD087, 0xAE18, 0xD73D, 0xCEFC, 0xCEFC, 0x0070, 
-0xBEBB, 0xCC11, 0xC002, 0xC005, 0xC005, 0x0012, 0xC003, 0xD2AD, 0xAE79, 0xCEFC, 0xCEFC, 0x006F, 0xCF1D, 0xB638, 0xC804, 0xC005, 
-0xC005, 0x0014, 0xC002, 0xB535, 0xCF3D, 0xCEFC, 0xCEFC, 0x006E, 0xBEBB, 0xCB70, 0xC003, 0xC005, 0xC005, 0x0014, 0xC004, 0xDA6D, 
-0xAE59, 0xCEFC, 0xCEFC, 0x006E, 0xAE79, 0xD0A7, 0xC004, 0xC005, 0xC005, 0x0015, 0xC003, 0xBE59, 0xCF1C, 0xCEFC, 0xCEFC, 0x006C, 
-0xCF1C, 0xBDD7, 0xC001, 0xC003, 0xC003, 0x0016, 0xC001, 0xBC11, 0xCF3D, 0xCEFC, 0xCEFC, 0x006C, 0xCF5D, 0xB34F, 0xED77, 0xFFFF, 
-0xFFFF, 0x0016, 0xFF7E, 0xCA4C, 0xBEBB, 0xCEFC, 0xCEFC, 0x006C, 0xC71C, 0xBA6C, 0xF67A, 0xFFBE, 0xFF9E, 0xFF9E, 0x0015, 0xFFFF, 
-0xD9CB, 0xAE38, 0xCEFC, 0xCEFC, 0x006C, 0xBEDB, 0xC22C, 0xF6FC, 0xFFBE, 0xFF9E, 0xFF9E, 0x0015, 0xFFFF, 0xD1AB, 0xAE59, 0xCEFC, 
-0xCEFC, 0x006C, 0xBEFC, 0xC24C, 0xF6BB, 0xFFBE, 0xFF9E, 0xFF9E, 0x0015, 0xFFFF, 0xD1AB, 0xAE39, 0xCEFC, 0xCEFC, 0x006C, 0xCF5D, 
-0xB2CD, 0xF5F9, 0xFFFF, 0xFFFF, 0x0016, 0xFFDF, 0xD22C, 0xAE79, 0xCEFC, 0xCEFC, 0x006C, 0xCF3D, 0xBCF4, 0xC8E8, 0xD28D, 0xD26D, 
-0xD26D, 0x0014, 0xD28D, 0xD1AA, 0xBB4F, 0xCF3D, 0xCEFC, 0xCEFC, 0x006D, 0xB69A, 0xC803, 0xC003, 0xC004, 0xC004, 0x0015, 0xC001, 
-0xBDB7, 0xCF1C, 0xCEFC, 0xCEFC, 0x006D, 0xAE59, 0xDAAD, 0xC004, 0xC005, 0xC005, 0x0014, 0xC004, 0xD129, 0xAE79, 0xCEFC, 0xCEFC, 
-0x006E, 0xCF3D, 0xB555, 0xC002, 0xC005, 0xC005, 0x0014, 0xC003, 0xC411, 0xC6FC, 0xCEFC, 0xCEFC, 0x006F, 0xAE79, 0xDA6D, 0xC003, 
-0xC005, 0xC005, 0x0012, 0xC004, 0xD108, 0xAE59, 0xCF1C, 0xCEFC, 0xCEFC, 0x006F, 0xD73D, 0xADF7, 0xD005, 0xC004, 0xC005, 0xC005, 
-0x0011, 0xC803, 0xBD76, 0xCF1C, 0xCEFC, 0xCEFC, 0x0071, 0xC6FC, 0xBD55, 0xC803, 0xC004, 0xC005, 0xC005, 0x000F, 0xC002, 0xCC93, 
-0xB6BA, 0xCEFC, 0xCEFC, 0x0073, 0xBEBB, 0xC535, 0xC804, 0xC004, 0xC005, 0xC005, 0x000C, 0xC004, 0xC002, 0xCC53, 0xAE9A, 0xCF1C, 
-0xCEFC, 0xCEFC, 0x0042, 0xD73D, 0xCEFC, 0xCEFC, 0x002F, 0xBEBB, 0xB596, 0xD0E8, 0xC003, 0xC004, 0xC005, 0xC005, 0x0009, 0xC003, 
-0xD005, 0xC515, 0xB69A, 0xCF1C, 0xCEFC, 0xCEFC, 0x0041, 0xD71D, 0x8CB1, 0x7C0E, 0xD75E, 0xCEFC, 0xCEFC, 0x002F, 0xCF1C, 0xAE59, 
-0xCBD1, 0xC805, 0xC003, 0xC004, 0xC004, 0x0000, 0xC005, 0xC005, 0x0002, 0xC004, 0xC004, 0x0000, 0xC003, 0xC804, 0xD32F, 0xAE38, 
-0xC6FB, 0xCEFC, 0xCEFC, 0x0040, 0xD73D, 0xD73D, 0x0001, 0xD75D, 0x8CD2, 0x3182, 0xA575, 0xD71D, 0xCEFC, 0xCEFC, 0x002F, 0xCF1C, 
-0xBEBB, 0xB679, 0xBC11, 0xDA8E, 0xD087, 0xC803, 0xC803, 0x0001, 0xC002, 0xC826, 0xDA4D, 0xBB90, 0xB659, 0xB69A, 0xCF1D, 0xCEFC, 
-0xCEFC, 0x0040, 0xCEDB, 0x5B0A, 0x6B8C, 0x7C0E, 0xBE59, 0xBE59, 0x0000, 0x39C4, 0x844F, 0xD73D, 0xCEFC, 0xCEFC, 0x0031, 0xCF1C, 
-0xCF5D, 0xA638, 0xB6BA, 0xAE38, 0x8C92, 0x8C71, 0xC6BA, 0xB6BA, 0xA638, 0xCF3D, 0xCF1C, 0xCEFC, 0xCEFC, 0x0041, 0xD71D, 0x8470, 
-0x7C2F, 0x8470, 0x4225, 0x31A3, 0x8470, 0x39E4, 0x8CD2, 0xE7BF, 0xC69A, 0xC6BA, 0xCF1C, 0xD73D, 0xCEFC, 0xCEFC, 0x0030, 0xD73D, 
-0xA5B7, 0x3A29, 0x29C7, 0xDF9E, 0xCEFC, 0xCEFC, 0x0046, 0xD71D, 0xDF7E, 0xE7BF, 0xE7DF, 0x7C2E, 0x3A05, 0x4246, 0x8CB1, 0x52E9, 
-0x31A3, 0x31C3, 0x39E4, 0x94F3, 0xD73D, 0xCEFC, 0xCEFC, 0x002F, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0046, 
-0xDF5E, 0x94F2, 0x3A04, 0x39E4, 0x6B8C, 0x5B09, 0x4A66, 0x4246, 0x5B09, 0x73CD, 0x8470, 0x634A, 0x2982, 0xC69A, 0xCEFC, 0xCEFC, 
-0x002F, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0045, 0xD73D, 0x8470, 0x31A3, 0x4A67, 0x6B6C, 0x52A8, 0x4246, 
-0x4A66, 0x4246, 0x94D2, 0xD75E, 0xD75E, 0x0000, 0xDF5E, 0xBE59, 0xADD7, 0xCEFC, 0xCEFC, 0x002F, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 
-0xDF7E, 0xCEFC, 0xCEFC, 0x0045, 0xC6DB, 0x2941, 0x73CD, 0xE7BF, 0xA575, 0x3A05, 0x5B09, 0x5247, 0x5B2A, 0x39C4, 0x52A8, 0xCEDC, 
-0xCEFC, 0xCEFC, 0x0032, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0033, 0xD73D, 0xDF5E, 0xDF5E, 0x0002, 0xD75D, 
-0xCEFC, 0xCEFC, 0x0009, 0xD71D, 0x94D2, 0x9D54, 0xDF5E, 0xD75E, 0x6B8C, 0x3A04, 0x94F2, 0x734B, 0xBE38, 0x6BAD, 0x39C4, 0x6B8C, 
-0xDF5E, 0xCEFC, 0xCEFC, 0x0031, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0032, 0xD73D, 0x8CD3, 0x52CB, 0x5B0C, 
-0x5B0C, 0x0002, 0xD71D, 0xCEFC, 0xCEFC, 0x0009, 0xCEDC, 0xD71D, 0xCEFC, 0xDF5E, 0x52E9, 0x4205, 0xCF1C, 0x94D2, 0x7BAD, 0xEFFF, 
-0x632A, 0x31A3, 0xBE7A, 0xCEFC, 0xCEFC, 0x0031, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0032, 0xDF9E, 0x18E3, 
-0x0000, 0x0000, 0x0003, 0xBE59, 0xCF1C, 0xCEFC, 0xCEFC, 0x000B, 0xDF5E, 0x4225, 0x632A, 0xDF9F, 0xB618, 0x4A05, 0xDF7E, 0xC6BB, 
-0x3183, 0x8491, 0xD73D, 0xCEFC, 0xCEFC, 0x0030, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0032, 0xDF9E, 0x2145, 
-0x0000, 0x0000, 0x0003, 0xBE7A, 0xCF1C, 0xCEFC, 0xCEFC, 0x000B, 0xD73D, 0x6BAC, 0x52C8, 0xDF5E, 0xD73D, 0x4183, 0xD75D, 0xDF5E, 
-0x634A, 0x7C0E, 0xD73D, 0xCEFC, 0xCEFC, 0x0030, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0032, 0xDF9E, 0x18E3, 
-0x0000, 0x0000, 0x0003, 0xC6BB, 0xCF1C, 0xCEFC, 0xCEFC, 0x000B, 0xCF1C, 0xADF7, 0x4225, 0xDF5E, 0xD75E, 0x41A3, 0xC67A, 0xD71D, 
-0xB5F7, 0x8CB1, 0xD71D, 0xCEFC, 0xCEFC, 0x0030, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0032, 0xD73D, 0x8CB3, 
-0x52CB, 0x8CD3, 0x6BCF, 0x7C31, 0x4249, 0x2124, 0xE7DF, 0xCEFC, 0xCEFC, 0x000C, 0xD75E, 0x844F, 0xD73D, 0xD75E, 0x5247, 0xB5F7, 
-0xCF1C, 0xCEFC, 0xCEFC, 0x0033, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0033, 0xD73D, 0xEFFF, 0x0000, 0x0000, 
-0x0000, 0x7C31, 0xF7FF, 0x31A6, 0x636E, 0xD73D, 0xCEFC, 0xCEFC, 0x000C, 0xD71D, 0xCEFC, 0xD75E, 0x6B0A, 0x9D34, 0xD71D, 0xCEFC, 
-0xCEFC, 0x0033, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0034, 0xE7BF, 0x5B2D, 0x1904, 0xD71C, 0xDF7E, 0x0000, 
-0x6B8E, 0xD73D, 0xCEFC, 0xCEFC, 0x000E, 0xD73D, 0x738C, 0x9491, 0xD73D, 0xCEFC, 0xCEFC, 0x0033, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 
-0xDF7E, 0xCEFC, 0xCEFC, 0x0033, 0xDF7E, 0x634D, 0x73CF, 0x7410, 0x6BCF, 0x0000, 0x73EF, 0xE79F, 0xCEFC, 0xCEFC, 0x0005, 0xD71C, 
-0xD71C, 0x0008, 0xDF5E, 0x7BCE, 0x8C70, 0xDF5D, 0xD71C, 0xD71C, 0x0033, 0xD73D, 0xADD7, 0x4249, 0x31E8, 0xDF9F, 0xCEFD, 0xCEFD, 
-0x0008, 0xCF1D, 0xCF1D, 0x0000, 0xCEFD, 0xCEFD, 0x000A, 0xCF1D, 0xCF1D, 0x0003, 0xCEFD, 0xCEFD, 0x0009, 0xCF1D, 0xCEFD, 0xCEFD, 
-0x0003, 0xCF1D, 0xCF1D, 0x0004, 0xD75E, 0x94F4, 0x0000, 0x0000, 0x0002, 0x5B0D, 0xE7DF, 0xCEFD, 0xCEFD, 0x0001, 0xCF1D, 0xCF1D, 
-0x0000, 0xCEFD, 0xCEFD, 0x0001, 0x84F5, 0x84F5, 0x0008, 0x8536, 0x630B, 0x632B, 0x8536, 0x84F5, 0x84F5, 0x0019, 0x8515, 0x8536, 
-0x8515, 0x84F5, 0x84F5, 0x0015, 0x8516, 0x7452, 0x4A6A, 0x3208, 0xEE52, 0xDDF1, 0xDDF1, 0x0008, 0xD590, 0xD590, 0x0000, 0xDDF1, 
-0xDDF1, 0x000A, 0xD5B0, 0xD590, 0xD590, 0x0001, 0xDDB0, 0xDDF1, 0xDDF1, 0x0009, 0xD5B0, 0xDDF1, 0xDDF1, 0x0002, 0xDDD0, 0xD5B0, 
-0xD590, 0xD590, 0x0003, 0xF672, 0x0840, 0x0000, 0x0000, 0x0002, 0x7309, 0xEE52, 0xDDF1, 0xDDF1, 0x0000, 0xDE11, 0xCD4F, 0xD5B0, 
-0xDDF1, 0xDDF1, 0x0001, 0x8515, 0x8515, 0x0008, 0x8D57, 0x632B, 0x6B4C, 0x8D57, 0x8515, 0x8515, 0x0018, 0x8516, 0x9597, 0x6BF0, 
-0x8515, 0x8D36, 0x8515, 0x8515, 0x0014, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xF630, 0xDDD0, 0xDDD0, 0x0003, 0xE5D0, 0xDDAF, 0xD56E, 
-0xD56E, 0x0001, 0xCD2E, 0xCD4E, 0xD56E, 0xDDCF, 0xE5D0, 0xDDD0, 0xDDD0, 0x0001, 0xD58F, 0xD56E, 0xD56F, 0xD56E, 0xD56E, 0x0000, 
-0xD58F, 0xD56F, 0xD56E, 0xD56E, 0x0002, 0xDDAF, 0xE5D0, 0xDDD0, 0xDDD0, 0x0002, 0xDDCF, 0xDDD0, 0xDDD0, 0x0000, 0xE5F0, 0xBCCC, 
-0xD56F, 0xD56E, 0xD56E, 0x0002, 0xD58F, 0xDDCF, 0xDDD0, 0xDDD0, 0x0002, 0xE610, 0xAC6C, 0x20E2, 0x0000, 0x0000, 0x0002, 0x6286, 
-0xE5CF, 0xD56E, 0xD56E, 0x0000, 0xBCCC, 0xD56E, 0xD56F, 0xD56E, 0xD56E, 0x0001, 0x8516, 0x8516, 0x0008, 0x8D57, 0x5AC9, 0x630B, 
-0x8D57, 0x8516, 0x8516, 0x0017, 0x8515, 0x9577, 0x2986, 0x0000, 0x0000, 0x0000, 0x8515, 0x8D36, 0x8516, 0x8516, 0x0013, 0x8D36, 
-0x7452, 0x4A6A, 0x3208, 0xE5CF, 0xD58F, 0xDDAF, 0xDDD0, 0xD56F, 0xCD4E, 0xCD4E, 0x0000, 0xD58F, 0xDDD0, 0xDDD0, 0x0004, 0xD56F, 
-0xC50E, 0xD56F, 0xD56F, 0x0000, 0xD58F, 0xDDB0, 0xDDD0, 0xDDD0, 0x0008, 0xD56F, 0xCD4E, 0xD56E, 0xD56E, 0x0000, 0xD56F, 0xDDD0, 
-0xE5F0, 0xE5F0, 0x0000, 0xCD4E, 0xCD2E, 0xE5F0, 0xCD4E, 0xD58F, 0xE5F0, 0xDDD0, 0xDDD0, 0x0005, 0xEE31, 0xFEF3, 0x1061, 0xD58F, 
-0x0000, 0x0000, 0x0002, 0x5A66, 0xEE51, 0xDDD0, 0xDDD0, 0x0000, 0xCD4E, 0xE5F0, 0xDDD0, 0xDDD0, 0x0002, 0x8516, 0x8516, 0x0008, 
-0x8D57, 0x5A88, 0x632B, 0x8D57, 0x8516, 0x8516, 0x0017, 0x8515, 0x95B8, 0x0000, 0x0000, 0x0001, 0x63D0, 0x8D56, 0x8516, 0x8516, 
-0x0013, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xEE30, 0xDDAF, 0xD58F, 0xC50D, 0xDDD0, 0xDDD0, 0x0007, 0xE5F0, 0xD58F, 0xD56F, 0xE5F0, 
-0xDDD0, 0xDDD0, 0x000B, 0xE5F0, 0xDDD0, 0xDDAF, 0xD58F, 0xD56F, 0xC50E, 0xC50D, 0xBCCD, 0xD58F, 0xE5F0, 0xDDD0, 0xE5F0, 0xD58F, 
-0xC50D, 0xDDB0, 0xE5F0, 0xDDD0, 0xDDD0, 0x0002, 0xEE31, 0x5A66, 0x0000, 0x0000, 0x0000, 0x41A4, 0xAC8C, 0x0000, 0x0000, 0x0001, 
-0x5226, 0xEE31, 0xDDD0, 0xE5F0, 0xC50D, 0xE5F0, 0xDDD0, 0xDDD0, 0x0002, 0x8516, 0x8516, 0x0008, 0x8D36, 0x73CE, 0x7430, 0x8D36, 
-0x8516, 0x8516, 0x0017, 0x8D36, 0x9597, 0x7452, 0x0882, 0x3208, 0x9DD9, 0x8D36, 0x8516, 0x8516, 0x0013, 0x8D36, 0x7452, 0x4A6A, 
-0x3208, 0xF651, 0xE5F0, 0xC50E, 0xE5F0, 0xE5D0, 0xDDD0, 0xDDD0, 0x0005, 0xE5F0, 0xD56E, 0xD56F, 0xE5F0, 0xDDD0, 0xDDD0, 0x0005, 
-0xD58F, 0xD56F, 0xD56F, 0x0006, 0xD58F, 0xDDD0, 0xDDD0, 0x0000, 0xE5F0, 0xD56F, 0xD56F, 0x0000, 0xE5F0, 0xDDD0, 0xDDD0, 0x0002, 
-0xE5F0, 0xCD4E, 0xCD2E, 0xDDD0, 0xDDD0, 0x0002, 0xF671, 0x20E2, 0x0000, 0x0000, 0x0001, 0x4A05, 0x0020, 0x0000, 0x0000, 0x0000, 
-0x49E5, 0xF651, 0xDDD0, 0xE5F0, 0xC50D, 0xE5F0, 0xDDD0, 0xDDD0, 0x0002, 0x8516, 0x8516, 0x0008, 0x8D36, 0x7C51, 0x7C72, 0x8D36, 
-0x8516, 0x8516, 0x0016, 0x8D36, 0x7452, 0x4ACC, 0x532D, 0x5B6E, 0x5B4E, 0x4ACC, 0x8D36, 0x8516, 0x8516, 0x0013, 0x8D36, 0x7452, 
-0x4A6A, 0x3208, 0xEE10, 0xCD2E, 0xCD2E, 0x0000, 0xCD4E, 0xCD4E, 0x0002, 0xD56F, 0xD58F, 0xDDAF, 0xDDB0, 0xE5F0, 0xCD4E, 0xCD4E, 
-0x0000, 0xDDAF, 0xD56F, 0xD56E, 0xD56E, 0x0000, 0xD56F, 0xD56F, 0x0002, 0xD58F, 0xDDAF, 0xDDD0, 0xDDD0, 0x0009, 0xE5F0, 0xBCCD, 
-0xE5F0, 0xDDD0, 0xDDD0, 0x0001, 0xE5F0, 0xD58F, 0xCD4E, 0xCD4E, 0x0000, 0xD56E, 0xD56F, 0xD56E, 0xD56E, 0x0001, 0xE5F0, 0x0840, 
-0x0000, 0x0000, 0x0001, 0x6286, 0x0000, 0x0000, 0x0001, 0x3984, 0xE5D0, 0xCD4E, 0xCD4E, 0x0002, 0xCD6E, 0xCD4E, 0xD56F, 0xDDAF, 
-0x8516, 0x8516, 0x0008, 0x8D36, 0x7C92, 0x7C93, 0x8D36, 0x8516, 0x8516, 0x0016, 0x95B8, 0x0861, 0x0000, 0x0000, 0x0003, 0x6BF0, 
-0x8D56, 0x8516, 0x8516, 0x0012, 0x8D36, 0x7452, 0x4A6A, 0x31E8, 0xE5F0, 0xE5F0, 0x0001, 0xDDD0, 0xDDD0, 0x0003, 0xDDAF, 0xD58F, 
-0xD58F, 0x0000, 0xC50D, 0xC50D, 0x0000, 0xBCCD, 0xC50E, 0xDDAF, 0xE5F0, 0xE5F0, 0x0001, 0xDDD0, 0xDDD0, 0x000E, 0xDDAF, 0xC50D, 
-0xE5F0, 0xDDAF, 0xCD4E, 0xCD4E, 0x0001, 0xD58F, 0xDDD0, 0xDDD0, 0x0005, 0xF672, 0x0000, 0x0000, 0x0002, 0x6287, 0x0000, 0x0000, 
-0x0001, 0x3964, 0xF651, 0xDDD0, 0xDDD0, 0x0005, 0xD58F, 0x8516, 0x8516, 0x0008, 0x8536, 0x7C93, 0x7CB3, 0x8536, 0x8516, 0x8516, 
-0x0015, 0x8D36, 0x7452, 0x0000, 0x0000, 0x0003, 0x0021, 0x8515, 0x9577, 0x8516, 0x8516, 0x0012, 0x8D36, 0x7452, 0x4A6A, 0x3208, 
-0xF651, 0xDDD0, 0xDDD0, 0x0007, 0xE5F0, 0xC4ED, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xCD4E, 0xC50E, 0xC50E, 0x0000, 0xCD6E, 0xDDD0, 
-0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x0009, 0xE5F0, 0xDDD0, 0xBCCD, 0xBCCD, 0x0000, 0xC50D, 0xCD4E, 0xDDD0, 0xE5F0, 0xE5F0, 
-0x0001, 0xDDD0, 0xDDD0, 0x0004, 0xE5F0, 0xEE51, 0x0000, 0x0000, 0x0002, 0x5226, 0x0000, 0x0000, 0x0001, 0x2923, 0xF672, 0xE5F0, 
-0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x0003, 0xE5F0, 0x8516, 0x8516, 0x0008, 0x8536, 0x84B4, 0x84D4, 0x8536, 0x8516, 0x8516, 0x0015, 
-0x9598, 0x10C3, 0x0000, 0x10C3, 0x2186, 0x10E4, 0x4ACC, 0x29C7, 0x0000, 0x42AB, 0x8D77, 0x8516, 0x8516, 0x0011, 0x8D36, 0x7452, 
-0x4A6A, 0x3208, 0xF631, 0xDDD0, 0xDDD0, 0x0006, 0xE5F0, 0xC50D, 0xDDAF, 0xDDD0, 0xDDD0, 0x0002, 0xE5F0, 0xE5F0, 0x0000, 0xDDAF, 
-0xCD2E, 0xC50E, 0xC50E, 0x0000, 0xD58F, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x0003, 0xD58F, 0xCD4E, 0xCD4E, 0x0001, 0xD56F, 
-0xDDD0, 0xDDD0, 0x0000, 0xD58F, 0xD56F, 0xCD4E, 0xCD4E, 0x0005, 0xD56F, 0xD56F, 0x0000, 0xCD4E, 0xCD2E, 0xBCCD, 0x0000, 0x0000, 
-0x0002, 0x5A66, 0x0000, 0x0000, 0x0001, 0x18C2, 0xD54E, 0xC4ED, 0xCD2E, 0xCD6E, 0xD58F, 0xDDD0, 0xE5F0, 0xD58F, 0xC4ED, 0x8516, 
-0x8516, 0x0009, 0x84D4, 0x84F5, 0x8516, 0x8516, 0x0013, 0x8536, 0x8D56, 0x8D77, 0x84D4, 0x632C, 0x7BEF, 0x734B, 0x62A9, 0x630B, 
-0x6B6D, 0x5B2C, 0x4AEC, 0x10E4, 0x8D36, 0x8D36, 0x0000, 0x8516, 0x8516, 0x0010, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xF631, 0xDDD0, 
-0xDDD0, 0x0005, 0xE5F0, 0xDDD0, 0xC4ED, 0xE610, 0xDDD0, 0xDDD0, 0x0008, 0xCD4E, 0xC4ED, 0xC4ED, 0x0000, 0xCD4E, 0xD58F, 0xCD2E, 
-0xCD4E, 0xCD2E, 0xD58F, 0xE5F0, 0xDDD0, 0xDDD0, 0x000A, 0xE5F0, 0xE5D0, 0xBCAC, 0xCD2E, 0xD56F, 0xD5AF, 0xE610, 0xB4CD, 0x93CA, 
-0x7B29, 0x72E8, 0x62A7, 0x0000, 0x0000, 0x0001, 0x1081, 0xF672, 0xDDB0, 0xD56F, 0xCD4E, 0xC50D, 0xBCCD, 0xB46C, 0xC4ED, 0xE5F0, 
-0x8516, 0x8516, 0x0006, 0x8515, 0x8516, 0x8516, 0x0000, 0x84F5, 0x8515, 0x8516, 0x8516, 0x0012, 0x8D57, 0x8D36, 0x738D, 0x6246, 
-0x5A05, 0x6226, 0x5A26, 0x6246, 0x5205, 0x49A4, 0x49A4, 0x0002, 0x5A88, 0x73CF, 0x8D77, 0x8D36, 0x8516, 0x8516, 0x000F, 0x8D36, 
-0x7452, 0x4A6A, 0x3208, 0xF631, 0xDDD0, 0xDDD0, 0x0001, 0xE5F0, 0xE5F0, 0x0001, 0xD56F, 0xBCED, 0xB48C, 0xAC6C, 0xCD2E, 0xCD4E, 
-0xCD4E, 0x0007, 0xD56F, 0xD58F, 0xD56F, 0xBCCD, 0xC50E, 0xAC6C, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x000C, 0xE5F0, 0xD58F, 
-0xB48C, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x0001, 0xE5F0, 0xEE10, 0xF651, 0xA42B, 0x0000, 0x2923, 0x20E2, 0x18C2, 0x3164, 
-0xEE51, 0xDDD0, 0xDDD0, 0x0001, 0xE5F0, 0xE5F0, 0x0001, 0xB46C, 0xE5F0, 0x8516, 0x8516, 0x0006, 0x8515, 0x8516, 0x8516, 0x0000, 
-0x84F5, 0x8515, 0x8516, 0x8516, 0x0000, 0x8515, 0x8516, 0x8516, 0x000D, 0x8536, 0x8D77, 0x73CF, 0x5A05, 0x5A26, 0x6246, 0x6247, 
-0x6247, 0x0001, 0x6267, 0x5206, 0x49C5, 0x49C5, 0x0003, 0x4984, 0x49C5, 0x7C51, 0x8D77, 0x8516, 0x8516, 0x000E, 0x8D36, 0x7452, 
-0x4A6A, 0x3208, 0xF651, 0xE5F0, 0xE5F0, 0x0000, 0xD58F, 0xC50D, 0xB48C, 0xB48C, 0x0000, 0xC50E, 0xD5AF, 0xE5F0, 0xDDD0, 0xBCCD, 
-0xC50D, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x0002, 0xE5F0, 0xE5F0, 0x0000, 0xDDAF, 0xC50D, 0xCD2E, 0xE5F0, 0xE5F0, 0x0000, 
-0xD58F, 0xAC6C, 0xE5F0, 0xDDD0, 0xDDD0, 0x000B, 0xE5F0, 0xCD4E, 0xBCCD, 0xE5F0, 0xDDD0, 0xDDD0, 0x0006, 0xEE11, 0xF651, 0x0840, 
-0x8BAA, 0x7308, 0xFE92, 0xDDD0, 0xDDD0, 0x0004, 0xE5F0, 0xB4AC, 0xDDB0, 0x8516, 0x8516, 0x0006, 0x8515, 0x8516, 0x8516, 0x0000, 
-0x8515, 0x8516, 0x8516, 0x0009, 0x8515, 0x8516, 0x8D36, 0x8D56, 0x8516, 0x8516, 0x0000, 0x8D36, 0x8D57, 0x8D57, 0x0000, 0x6288, 
-0x5A05, 0x6247, 0x6247, 0x0004, 0x6267, 0x5206, 0x49C5, 0x49C5, 0x0005, 0x4163, 0x62EA, 0x8D98, 0x8D56, 0x8D36, 0x8516, 0x8516, 
-0x0000, 0x8D56, 0x8D36, 0x8516, 0x8515, 0x8516, 0x8516, 0x0005, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xDD8F, 0xB48C, 0xAC6C, 0xBCED, 
-0xD56F, 0xE5F0, 0xE5F0, 0x0001, 0xDDD0, 0xDDD0, 0x0001, 0xE5F0, 0xD58F, 0xB48C, 0xC52E, 0xE5F0, 0xE5D0, 0xE5D0, 0x0000, 0xE5F0, 
-0xD56F, 0xBCED, 0xCD4E, 0xE5F0, 0xE5D0, 0xDDD0, 0xDDD0, 0x0000, 0xE5F0, 0xCD4E, 0xAC6C, 0xE610, 0xDDD0, 0xDDD0, 0x0006, 0xE5F0, 
-0xE5F0, 0x0002, 0xC4ED, 0xCD2E, 0xE611, 0xDDD0, 0xDDD0, 0x0008, 0xE5F0, 0x0000, 0x7B28, 0x6287, 0xEE31, 0xDDD0, 0xDDD0, 0x0004, 
-0xE5F0, 0xCD4E, 0xC50E, 0x8516, 0x8516, 0x0014, 0x8D36, 0x8D77, 0x8D77, 0x0000, 0x7C52, 0x6B8E, 0x8D98, 0x8D77, 0x84D4, 0x634D, 
-0x49E6, 0x6226, 0x6247, 0x6247, 0x0005, 0x6267, 0x5206, 0x49C5, 0x49C5, 0x0006, 0x4984, 0x4A07, 0x632D, 0x84D4, 0x8D77, 0x8D98, 
-0x6B8E, 0x7452, 0x8D77, 0x8D77, 0x0000, 0x8D36, 0x8516, 0x8516, 0x0004, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xDD8F, 0xDDD0, 0xE5F0, 
-0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x0007, 0xE5F0, 0xCD4E, 0xAC6C, 0xD56F, 0xCD2E, 0xBCCD, 0xD56F, 0xE5F0, 0xDDD0, 0xDDD0, 0x0004, 
-0xE5F0, 0xBCED, 0xB4AC, 0xE610, 0xDDD0, 0xDDD0, 0x0000, 0xE5F0, 0xE5F0, 0x0002, 0xD58F, 0xC52E, 0xB4AC, 0xAC6C, 0xB46C, 0xAC6C, 
-0xB4AC, 0xBCCD, 0xD56F, 0xE5F0, 0xE5F0, 0x0001, 0xDDD0, 0xDDD0, 0x0004, 0xE5F0, 0x7308, 0xB4AD, 0xAC6C, 0xE5F0, 0xDDD0, 0xDDD0, 
-0x0005, 0xE5F0, 0xAC6C, 0x8516, 0x8516, 0x0012, 0x8536, 0x8D57, 0x7410, 0x5AAA, 0x3943, 0x3923, 0x3923, 0x0000, 0x5269, 0x49E6, 
-0x5289, 0x7431, 0x95B8, 0x5A26, 0x6247, 0x6247, 0x0005, 0x6267, 0x5206, 0x49C5, 0x49C5, 0x0005, 0x49A5, 0x5A68, 0x95B9, 0x7431, 
-0x5289, 0x49E6, 0x5289, 0x3923, 0x3923, 0x0000, 0x3943, 0x528A, 0x73F0, 0x8D56, 0x8D36, 0x8516, 0x8516, 0x0002, 0x8D36, 0x7452, 
-0x4A6A, 0x3208, 0xF651, 0xDDD0, 0xDDD0, 0x000B, 0xE5F0, 0xE611, 0xA40B, 0xDDAF, 0xE5F0, 0xDDD0, 0xDDD0, 0x0007, 0xE610, 0xB48C, 
-0xBCED, 0xE611, 0xD58F, 0xC52E, 0xB4AD, 0xAC4B, 0xAC6B, 0xBCCD, 0xCD2E, 0xDDAF, 0xE5F0, 0xE610, 0xB48C, 0xE611, 0xDDD0, 0xC50E, 
-0xB48C, 0xB48C, 0x0000, 0xC50E, 0xDDD0, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x0002, 0xEE11, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 
-0xDDD0, 0x0003, 0xE5F0, 0xE5F0, 0x0001, 0xD58F, 0xA42B, 0x8516, 0x8516, 0x0012, 0x8D36, 0x30E2, 0x3923, 0x3964, 0x4184, 0x4184, 
-0x0000, 0x3964, 0x5248, 0x95B8, 0x8D57, 0x8D36, 0x8D57, 0x6B4C, 0x5A26, 0x6247, 0x6247, 0x0004, 0x6267, 0x5206, 0x49C5, 0x49C5, 
-0x0005, 0x4984, 0x73EF, 0x8D56, 0x8D36, 0x8D57, 0x95B8, 0x5269, 0x3964, 0x4184, 0x4184, 0x0000, 0x3964, 0x3923, 0x30E2, 0x8515, 
-0x8536, 0x8516, 0x8516, 0x0001, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xF631, 0xDDD0, 0xDDD0, 0x000B, 0xE5F0, 0xBCCD, 0xCD2E, 0xE5F0, 
-0xDDD0, 0xDDD0, 0x0007, 0xE5F0, 0xE610, 0xCD2E, 0x93CA, 0x9BEA, 0xB4AC, 0xCD2E, 0xDDAF, 0xE5F0, 0xE5F0, 0x0002, 0xDDD0, 0xDDD0, 
-0x0000, 0xE5F0, 0xAC4B, 0xE5F0, 0xDDD0, 0xE5F0, 0xE5F0, 0x0001, 0xCD4E, 0xB48C, 0xAC4B, 0xBCCD, 0xD58F, 0xE5F0, 0xE5F0, 0x0001, 
-0xDDD0, 0xDDD0, 0x0002, 0xE5F0, 0xE5F0, 0x0000, 0xE610, 0xD58F, 0xC4ED, 0xAC4B, 0xA40B, 0xB4AC, 0xCD4E, 0x8516, 0x8516, 0x0012, 
-0x8D77, 0x41A5, 0x41A5, 0x0003, 0x4185, 0x6BCF, 0x8D56, 0x8516, 0x8516, 0x0000, 0x8536, 0x84F5, 0x59E5, 0x6247, 0x6247, 0x0004, 
-0x5A26, 0x51C4, 0x49A4, 0x49C5, 0x49C5, 0x0004, 0x49A4, 0x8D77, 0x8516, 0x8516, 0x0001, 0x8D56, 0x73F0, 0x4185, 0x41A5, 0x41A5, 
-0x0002, 0x4184, 0x8D57, 0x8516, 0x8516, 0x0002, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xF631, 0xDDD0, 0xDDD0, 0x000B, 0xD58F, 0xAC4B, 
-0xE610, 0xDDD0, 0xDDD0, 0x0006, 0xE5F0, 0xE610, 0xC50E, 0x9BEA, 0xB48C, 0xDDB0, 0xD58F, 0xB4AD, 0xB48C, 0xC52E, 0xE5F0, 0xE5F0, 
-0x0001, 0xDDD0, 0xDDD0, 0x0001, 0xE5F0, 0xA42B, 0xE5F0, 0xDDD0, 0xDDD0, 0x0002, 0xE5F0, 0xE5F0, 0x0001, 0xD56F, 0xB4AD, 0xA42B, 
-0xB48C, 0xCD2E, 0xE5F0, 0xE5F0, 0x0000, 0xE610, 0xDDD0, 0xC50E, 0xAC6C, 0x9C0B, 0xAC6C, 0xC50E, 0xDDAF, 0xE610, 0xE5F0, 0xE5F0, 
-0x0000, 0x8516, 0x8516, 0x0012, 0x8536, 0x7C52, 0x7C72, 0x7C72, 0x0003, 0x7CB3, 0x8D36, 0x8516, 0x8516, 0x0000, 0x8515, 0x8D57, 
-0x6B6C, 0x59E5, 0x5A05, 0x5A05, 0x0002, 0x51E4, 0x83AD, 0x94B2, 0x6B2B, 0x4184, 0x4163, 0x4163, 0x0002, 0x4142, 0x73F0, 0x8536, 
-0x8515, 0x8516, 0x8516, 0x0000, 0x8D36, 0x7CB3, 0x7C72, 0x7C72, 0x0003, 0x7C52, 0x8516, 0x8516, 0x0003, 0x8D36, 0x7452, 0x4A6A, 
-0x3208, 0xF631, 0xDDD0, 0xDDD0, 0x0008, 0xE5D0, 0xE5F0, 0xE610, 0x9BEA, 0xE5D0, 0xDDD0, 0xDDD0, 0x0005, 0xE5F0, 0xE610, 0xC50E, 
-0x9BEA, 0xB4AC, 0xDDD0, 0xE5F0, 0xDDD0, 0xDDD0, 0x0000, 0xE5F0, 0xE5F0, 0x0000, 0xCD2E, 0xAC4C, 0xAC4B, 0xC50E, 0xE5F0, 0xE5F0, 
-0x0002, 0xA44B, 0xDDAF, 0xDDD0, 0xDDD0, 0x0006, 0xE5F0, 0xE5F0, 0x0000, 0xDDAF, 0xBCED, 0xA42B, 0xAC6C, 0xA42B, 0xA42B, 0x0000, 
-0xBCED, 0xD58F, 0xE5F0, 0xE5F0, 0x0001, 0xDDD0, 0xDDD0, 0x0002, 0x8516, 0x8516, 0x0012, 0x8536, 0x84D4, 0x7C93, 0x7C72, 0x7C72, 
-0x0003, 0x84D4, 0x8515, 0x8516, 0x8D36, 0x9DB7, 0x9D97, 0x842F, 0x94B2, 0x94B2, 0x0000, 0x94F3, 0x9D55, 0x9D54, 0xCEFC, 0xBE59, 
-0x9D35, 0xBE5A, 0xADD7, 0x9D34, 0x9D55, 0x9D14, 0x8C92, 0xAE3A, 0xA5B8, 0x8D36, 0x8516, 0x8515, 0x84D4, 0x7C72, 0x7C72, 0x0003, 
-0x7C93, 0x84D4, 0x8536, 0x8516, 0x8516, 0x0002, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xF651, 0xDDD0, 0xE5F0, 0xE5F0, 0x0005, 0xDDD0, 
-0xD5AF, 0xD56F, 0xCD4E, 0xAC4C, 0xCD4E, 0xE5F0, 0xDDD0, 0xDDD0, 0x0003, 0xE5F0, 0xE610, 0xC4ED, 0x9BEA, 0xBCCD, 0xE5F0, 0xE5F0, 
-0x0000, 0xDDD0, 0xDDD0, 0x0004, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xC50E, 0xA40B, 0xA42B, 0xC50E, 0xE610, 0xB48C, 0xD56F, 0xE610, 
-0xE5F0, 0xDDD0, 0xDDD0, 0x0007, 0xE5F0, 0xEE11, 0xB48C, 0xCD2E, 0xE610, 0xE5F0, 0xDDD0, 0xDDD0, 0x0006, 0x8516, 0x8516, 0x0013, 
-0x8536, 0x8D36, 0x8536, 0x84F5, 0x84D4, 0x7CB3, 0x8516, 0x84F5, 0x84D4, 0x84D4, 0x0000, 0x84F5, 0x8536, 0x73CF, 0x73EF, 0x73EF, 
-0x0002, 0x73CF, 0x73CF, 0x0000, 0x73AE, 0x6B8E, 0x6BAE, 0x6B8E, 0x6BAE, 0x6BAE, 0x0003, 0x7451, 0x8516, 0x84F5, 0x84D4, 0x84D4, 
-0x0000, 0x84F5, 0x8536, 0x84B4, 0x84D4, 0x84F5, 0x8536, 0x8D36, 0x8536, 0x8516, 0x8516, 0x0003, 0x8D36, 0x7452, 0x4A6A, 0x3208, 
-0xEE30, 0xD56F, 0xC52E, 0xBCED, 0xB48C, 0xAC4B, 0xA40B, 0xA40B, 0x0000, 0xA42B, 0xAC6C, 0xBCAD, 0x9C0B, 0x8B89, 0xBCCD, 0x9BCA, 
-0xD56F, 0xE610, 0xDDD0, 0xDDD0, 0x0000, 0xE5F0, 0xE5F0, 0x0000, 0xBCED, 0x9BEA, 0xBCED, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 
-0x0009, 0xE5F0, 0xE610, 0xDDD0, 0xBCCD, 0x9BEA, 0x9BEA, 0x0000, 0x93CA, 0xAC6C, 0xC50E, 0xDDD0, 0xE610, 0xE5F0, 0xE5F0, 0x0000, 
-0xDDD0, 0xDDD0, 0x0004, 0xE5F0, 0xB4AC, 0xBCED, 0xE5F0, 0xDDD0, 0xDDD0, 0x0007, 0x8516, 0x8516, 0x0017, 0x8536, 0x8536, 0x0000, 
-0x8516, 0x8516, 0x0003, 0x7C93, 0x7C10, 0x7C30, 0x7C30, 0x0005, 0x7C10, 0x7410, 0x7410, 0x0005, 0x73EF, 0x8515, 0x8515, 0x0000, 
-0x8516, 0x8516, 0x0002, 0x8536, 0x8536, 0x0000, 0x8516, 0x8516, 0x0007, 0x8D36, 0x7452, 0x4A6A, 0x31E8, 0xAC4B, 0xAC6C, 0xBCAD, 
-0xC50E, 0xCD6F, 0xDDAF, 0xE5F0, 0xEE31, 0xE610, 0xBCCD, 0x93CA, 0xBCCD, 0xE610, 0xE5F0, 0xE5D0, 0x9BEB, 0xAC4C, 0xE610, 0xE610, 
-0x0000, 0xBCCD, 0x9BEB, 0xC50E, 0xE610, 0xE5F0, 0xDDD0, 0xDDD0, 0x000E, 0xE5F0, 0xEE31, 0x8B8A, 0xDDD0, 0xC52E, 0xB48C, 0x9BEA, 
-0x93AA, 0xA44B, 0xBCED, 0xD58F, 0xE610, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x0000, 0xE5F0, 0xBCCD, 0xB4AD, 0xE5F0, 0xDDD0, 
-0xDDD0, 0x0007, 0x8516, 0x8516, 0x001D, 0x8D36, 0x7C51, 0x7C51, 0x0008, 0x7451, 0x7451, 0x0005, 0x7431, 0x84B4, 0x8536, 0x8516, 
-0x8516, 0x000D, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xF671, 0xE5F0, 0xE5F0, 0x0002, 0xE610, 0xDDAF, 0xAC4C, 0x8B69, 0xBCCD, 0xE610, 
-0xE5F0, 0xDDD0, 0xDDD0, 0x0001, 0xE610, 0xC50E, 0x93AA, 0xA42B, 0xCD6F, 0xE610, 0xE5F0, 0xDDD0, 0xDDD0, 0x0010, 0xE5F0, 0xB48C, 
-0xB4AD, 0xE5F0, 0xE5F0, 0x0001, 0xE610, 0xE610, 0x0000, 0xD58F, 0xBCED, 0xA44C, 0x9BEA, 0xA42B, 0xBCCD, 0xD56F, 0xE5F0, 0xE610, 
-0xC50E, 0xAC6C, 0xE5F0, 0xDDD0, 0xDDD0, 0x0007, 0x8516, 0x8516, 0x001D, 0x8515, 0x7C72, 0x7C92, 0x7C92, 0x0006, 0x7C72, 0x7C72, 
-0x0007, 0x7C93, 0x8D36, 0x8516, 0x8516, 0x000D, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xF631, 0xDDD0, 0xDDD0, 0x0001, 0xCD2E, 0xA40B, 
-0x93AA, 0xC50E, 0xE610, 0xE5F0, 0xDDD0, 0xDDD0, 0x0004, 0xE5F0, 0xDDD0, 0x93CA, 0xCD2E, 0xE5F0, 0xDDD0, 0xDDD0, 0x0011, 0xDDAF, 
-0x8B8A, 0xE610, 0xDDD0, 0xDDD0, 0x0004, 0xE5F0, 0xE5F0, 0x0000, 0xE610, 0xE5F0, 0xCD4E, 0xBCCD, 0xAC6C, 0xAC6C, 0x0000, 0xAC4C, 
-0xA44C, 0xE5F0, 0xDDD0, 0xDDD0, 0x0007
+#include "picture.h"
+
+const unsigned short Bild1[BILD1_LENGTH] = {
+0xCEFC, 0xCEFC, 0x05B7, 0xCF1C, 0xCF3D, 0xBEDB, 0xAE59, 0xAE79, 0xAE79, 0x0000, 0xAE59, 0xB69A, 0xCF5D, 0xCF1C, 0xCEFC, 0xCEFC,
+0x007E, 0xCF3D, 0xAE79, 0xB679, 0xBC52, 0xCB0E, 0xDA4C, 0xD18A, 0xD18A, 0x0000, 0xDA2C, 0xD2EE, 0xBBF1, 0xBE38, 0xAE59, 0xCF3D,
+0xCEFC, 0xCEFC, 0x007A, 0xCF1D, 0xB69A, 0xB5D7, 0xD2CE, 0xC804, 0xC003, 0xC004, 0xC004, 0x0004, 0xC003, 0xC003, 0x0000, 0xDA4C,
+0xBD35, 0xAE79, 0xD73D, 0xCEFC, 0xCEFC, 0x0077, 0xCF3D, 0xA658, 0xD390, 0xC803, 0xC003, 0xC005, 0xC005, 0x0008, 0xC004, 0xC002,
+0xD2AE, 0xAE18, 0xCF1C, 0xCEFC, 0xCEFC, 0x0075, 0xCF1D, 0xA5F7, 0xD98A, 0xC003, 0xC005, 0xC005, 0x000C, 0xC003, 0xD087, 0xB5B6,
+0xC6FC, 0xCEFC, 0xCEFC, 0x0073, 0xD73D, 0xA5F7, 0xD108, 0xC003, 0xC005, 0xC005, 0x000E, 0xC004, 0xD005, 0xB5B6, 0xCF1C, 0xCEFC,
+0xCEFC, 0x0071, 0xCF1C, 0xAE59, 0xD9CB, 0xC003, 0xC005, 0xC005, 0x0010, 0xC004, 0xD087, 0xAE18, 0xD73D, 0xCEFC, 0xCEFC, 0x0070,
+0xBEBB, 0xCC11, 0xC002, 0xC005, 0xC005, 0x0012, 0xC003, 0xD2AD, 0xAE79, 0xCEFC, 0xCEFC, 0x006F, 0xCF1D, 0xB638, 0xC804, 0xC005,
+0xC005, 0x0014, 0xC002, 0xB535, 0xCF3D, 0xCEFC, 0xCEFC, 0x006E, 0xBEBB, 0xCB70, 0xC003, 0xC005, 0xC005, 0x0014, 0xC004, 0xDA6D,
+0xAE59, 0xCEFC, 0xCEFC, 0x006E, 0xAE79, 0xD0A7, 0xC004, 0xC005, 0xC005, 0x0015, 0xC003, 0xBE59, 0xCF1C, 0xCEFC, 0xCEFC, 0x006C,
+0xCF1C, 0xBDD7, 0xC001, 0xC003, 0xC003, 0x0016, 0xC001, 0xBC11, 0xCF3D, 0xCEFC, 0xCEFC, 0x006C, 0xCF5D, 0xB34F, 0xED77, 0xFFFF,
+0xFFFF, 0x0016, 0xFF7E, 0xCA4C, 0xBEBB, 0xCEFC, 0xCEFC, 0x006C, 0xC71C, 0xBA6C, 0xF67A, 0xFFBE, 0xFF9E, 0xFF9E, 0x0015, 0xFFFF,
+0xD9CB, 0xAE38, 0xCEFC, 0xCEFC, 0x006C, 0xBEDB, 0xC22C, 0xF6FC, 0xFFBE, 0xFF9E, 0xFF9E, 0x0015, 0xFFFF, 0xD1AB, 0xAE59, 0xCEFC,
+0xCEFC, 0x006C, 0xBEFC, 0xC24C, 0xF6BB, 0xFFBE, 0xFF9E, 0xFF9E, 0x0015, 0xFFFF, 0xD1AB, 0xAE39, 0xCEFC, 0xCEFC, 0x006C, 0xCF5D,
+0xB2CD, 0xF5F9, 0xFFFF, 0xFFFF, 0x0016, 0xFFDF, 0xD22C, 0xAE79, 0xCEFC, 0xCEFC, 0x006C, 0xCF3D, 0xBCF4, 0xC8E8, 0xD28D, 0xD26D,
+0xD26D, 0x0014, 0xD28D, 0xD1AA, 0xBB4F, 0xCF3D, 0xCEFC, 0xCEFC, 0x006D, 0xB69A, 0xC803, 0xC003, 0xC004, 0xC004, 0x0015, 0xC001,
+0xBDB7, 0xCF1C, 0xCEFC, 0xCEFC, 0x006D, 0xAE59, 0xDAAD, 0xC004, 0xC005, 0xC005, 0x0014, 0xC004, 0xD129, 0xAE79, 0xCEFC, 0xCEFC,
+0x006E, 0xCF3D, 0xB555, 0xC002, 0xC005, 0xC005, 0x0014, 0xC003, 0xC411, 0xC6FC, 0xCEFC, 0xCEFC, 0x006F, 0xAE79, 0xDA6D, 0xC003,
+0xC005, 0xC005, 0x0012, 0xC004, 0xD108, 0xAE59, 0xCF1C, 0xCEFC, 0xCEFC, 0x006F, 0xD73D, 0xADF7, 0xD005, 0xC004, 0xC005, 0xC005,
+0x0011, 0xC803, 0xBD76, 0xCF1C, 0xCEFC, 0xCEFC, 0x0071, 0xC6FC, 0xBD55, 0xC803, 0xC004, 0xC005, 0xC005, 0x000F, 0xC002, 0xCC93,
+0xB6BA, 0xCEFC, 0xCEFC, 0x0073, 0xBEBB, 0xC535, 0xC804, 0xC004, 0xC005, 0xC005, 0x000C, 0xC004, 0xC002, 0xCC53, 0xAE9A, 0xCF1C,
+0xCEFC, 0xCEFC, 0x0042, 0xD73D, 0xCEFC, 0xCEFC, 0x002F, 0xBEBB, 0xB596, 0xD0E8, 0xC003, 0xC004, 0xC005, 0xC005, 0x0009, 0xC003,
+0xD005, 0xC515, 0xB69A, 0xCF1C, 0xCEFC, 0xCEFC, 0x0041, 0xD71D, 0x8CB1, 0x7C0E, 0xD75E, 0xCEFC, 0xCEFC, 0x002F, 0xCF1C, 0xAE59,
+0xCBD1, 0xC805, 0xC003, 0xC004, 0xC004, 0x0000, 0xC005, 0xC005, 0x0002, 0xC004, 0xC004, 0x0000, 0xC003, 0xC804, 0xD32F, 0xAE38,
+0xC6FB, 0xCEFC, 0xCEFC, 0x0040, 0xD73D, 0xD73D, 0x0001, 0xD75D, 0x8CD2, 0x3182, 0xA575, 0xD71D, 0xCEFC, 0xCEFC, 0x002F, 0xCF1C,
+0xBEBB, 0xB679, 0xBC11, 0xDA8E, 0xD087, 0xC803, 0xC803, 0x0001, 0xC002, 0xC826, 0xDA4D, 0xBB90, 0xB659, 0xB69A, 0xCF1D, 0xCEFC,
+0xCEFC, 0x0040, 0xCEDB, 0x5B0A, 0x6B8C, 0x7C0E, 0xBE59, 0xBE59, 0x0000, 0x39C4, 0x844F, 0xD73D, 0xCEFC, 0xCEFC, 0x0031, 0xCF1C,
+0xCF5D, 0xA638, 0xB6BA, 0xAE38, 0x8C92, 0x8C71, 0xC6BA, 0xB6BA, 0xA638, 0xCF3D, 0xCF1C, 0xCEFC, 0xCEFC, 0x0041, 0xD71D, 0x8470,
+0x7C2F, 0x8470, 0x4225, 0x31A3, 0x8470, 0x39E4, 0x8CD2, 0xE7BF, 0xC69A, 0xC6BA, 0xCF1C, 0xD73D, 0xCEFC, 0xCEFC, 0x0030, 0xD73D,
+0xA5B7, 0x3A29, 0x29C7, 0xDF9E, 0xCEFC, 0xCEFC, 0x0046, 0xD71D, 0xDF7E, 0xE7BF, 0xE7DF, 0x7C2E, 0x3A05, 0x4246, 0x8CB1, 0x52E9,
+0x31A3, 0x31C3, 0x39E4, 0x94F3, 0xD73D, 0xCEFC, 0xCEFC, 0x002F, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0046,
+0xDF5E, 0x94F2, 0x3A04, 0x39E4, 0x6B8C, 0x5B09, 0x4A66, 0x4246, 0x5B09, 0x73CD, 0x8470, 0x634A, 0x2982, 0xC69A, 0xCEFC, 0xCEFC,
+0x002F, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0045, 0xD73D, 0x8470, 0x31A3, 0x4A67, 0x6B6C, 0x52A8, 0x4246,
+0x4A66, 0x4246, 0x94D2, 0xD75E, 0xD75E, 0x0000, 0xDF5E, 0xBE59, 0xADD7, 0xCEFC, 0xCEFC, 0x002F, 0xD71C, 0xA5B7, 0x4249, 0x31E8,
+0xDF7E, 0xCEFC, 0xCEFC, 0x0045, 0xC6DB, 0x2941, 0x73CD, 0xE7BF, 0xA575, 0x3A05, 0x5B09, 0x5247, 0x5B2A, 0x39C4, 0x52A8, 0xCEDC,
+0xCEFC, 0xCEFC, 0x0032, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0033, 0xD73D, 0xDF5E, 0xDF5E, 0x0002, 0xD75D,
+0xCEFC, 0xCEFC, 0x0009, 0xD71D, 0x94D2, 0x9D54, 0xDF5E, 0xD75E, 0x6B8C, 0x3A04, 0x94F2, 0x734B, 0xBE38, 0x6BAD, 0x39C4, 0x6B8C,
+0xDF5E, 0xCEFC, 0xCEFC, 0x0031, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0032, 0xD73D, 0x8CD3, 0x52CB, 0x5B0C,
+0x5B0C, 0x0002, 0xD71D, 0xCEFC, 0xCEFC, 0x0009, 0xCEDC, 0xD71D, 0xCEFC, 0xDF5E, 0x52E9, 0x4205, 0xCF1C, 0x94D2, 0x7BAD, 0xEFFF,
+0x632A, 0x31A3, 0xBE7A, 0xCEFC, 0xCEFC, 0x0031, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0032, 0xDF9E, 0x18E3,
+0x0000, 0x0000, 0x0003, 0xBE59, 0xCF1C, 0xCEFC, 0xCEFC, 0x000B, 0xDF5E, 0x4225, 0x632A, 0xDF9F, 0xB618, 0x4A05, 0xDF7E, 0xC6BB,
+0x3183, 0x8491, 0xD73D, 0xCEFC, 0xCEFC, 0x0030, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0032, 0xDF9E, 0x2145,
+0x0000, 0x0000, 0x0003, 0xBE7A, 0xCF1C, 0xCEFC, 0xCEFC, 0x000B, 0xD73D, 0x6BAC, 0x52C8, 0xDF5E, 0xD73D, 0x4183, 0xD75D, 0xDF5E,
+0x634A, 0x7C0E, 0xD73D, 0xCEFC, 0xCEFC, 0x0030, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0032, 0xDF9E, 0x18E3,
+0x0000, 0x0000, 0x0003, 0xC6BB, 0xCF1C, 0xCEFC, 0xCEFC, 0x000B, 0xCF1C, 0xADF7, 0x4225, 0xDF5E, 0xD75E, 0x41A3, 0xC67A, 0xD71D,
+0xB5F7, 0x8CB1, 0xD71D, 0xCEFC, 0xCEFC, 0x0030, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0032, 0xD73D, 0x8CB3,
+0x52CB, 0x8CD3, 0x6BCF, 0x7C31, 0x4249, 0x2124, 0xE7DF, 0xCEFC, 0xCEFC, 0x000C, 0xD75E, 0x844F, 0xD73D, 0xD75E, 0x5247, 0xB5F7,
+0xCF1C, 0xCEFC, 0xCEFC, 0x0033, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0033, 0xD73D, 0xEFFF, 0x0000, 0x0000,
+0x0000, 0x7C31, 0xF7FF, 0x31A6, 0x636E, 0xD73D, 0xCEFC, 0xCEFC, 0x000C, 0xD71D, 0xCEFC, 0xD75E, 0x6B0A, 0x9D34, 0xD71D, 0xCEFC,
+0xCEFC, 0x0033, 0xD71C, 0xA5B7, 0x4249, 0x31E8, 0xDF7E, 0xCEFC, 0xCEFC, 0x0034, 0xE7BF, 0x5B2D, 0x1904, 0xD71C, 0xDF7E, 0x0000,
+0x6B8E, 0xD73D, 0xCEFC, 0xCEFC, 0x000E, 0xD73D, 0x738C, 0x9491, 0xD73D, 0xCEFC, 0xCEFC, 0x0033, 0xD71C, 0xA5B7, 0x4249, 0x31E8,
+0xDF7E, 0xCEFC, 0xCEFC, 0x0033, 0xDF7E, 0x634D, 0x73CF, 0x7410, 0x6BCF, 0x0000, 0x73EF, 0xE79F, 0xCEFC, 0xCEFC, 0x0005, 0xD71C,
+0xD71C, 0x0008, 0xDF5E, 0x7BCE, 0x8C70, 0xDF5D, 0xD71C, 0xD71C, 0x0033, 0xD73D, 0xADD7, 0x4249, 0x31E8, 0xDF9F, 0xCEFD, 0xCEFD,
+0x0008, 0xCF1D, 0xCF1D, 0x0000, 0xCEFD, 0xCEFD, 0x000A, 0xCF1D, 0xCF1D, 0x0003, 0xCEFD, 0xCEFD, 0x0009, 0xCF1D, 0xCEFD, 0xCEFD,
+0x0003, 0xCF1D, 0xCF1D, 0x0004, 0xD75E, 0x94F4, 0x0000, 0x0000, 0x0002, 0x5B0D, 0xE7DF, 0xCEFD, 0xCEFD, 0x0001, 0xCF1D, 0xCF1D,
+0x0000, 0xCEFD, 0xCEFD, 0x0001, 0x84F5, 0x84F5, 0x0008, 0x8536, 0x630B, 0x632B, 0x8536, 0x84F5, 0x84F5, 0x0019, 0x8515, 0x8536,
+0x8515, 0x84F5, 0x84F5, 0x0015, 0x8516, 0x7452, 0x4A6A, 0x3208, 0xEE52, 0xDDF1, 0xDDF1, 0x0008, 0xD590, 0xD590, 0x0000, 0xDDF1,
+0xDDF1, 0x000A, 0xD5B0, 0xD590, 0xD590, 0x0001, 0xDDB0, 0xDDF1, 0xDDF1, 0x0009, 0xD5B0, 0xDDF1, 0xDDF1, 0x0002, 0xDDD0, 0xD5B0,
+0xD590, 0xD590, 0x0003, 0xF672, 0x0840, 0x0000, 0x0000, 0x0002, 0x7309, 0xEE52, 0xDDF1, 0xDDF1, 0x0000, 0xDE11, 0xCD4F, 0xD5B0,
+0xDDF1, 0xDDF1, 0x0001, 0x8515, 0x8515, 0x0008, 0x8D57, 0x632B, 0x6B4C, 0x8D57, 0x8515, 0x8515, 0x0018, 0x8516, 0x9597, 0x6BF0,
+0x8515, 0x8D36, 0x8515, 0x8515, 0x0014, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xF630, 0xDDD0, 0xDDD0, 0x0003, 0xE5D0, 0xDDAF, 0xD56E,
+0xD56E, 0x0001, 0xCD2E, 0xCD4E, 0xD56E, 0xDDCF, 0xE5D0, 0xDDD0, 0xDDD0, 0x0001, 0xD58F, 0xD56E, 0xD56F, 0xD56E, 0xD56E, 0x0000,
+0xD58F, 0xD56F, 0xD56E, 0xD56E, 0x0002, 0xDDAF, 0xE5D0, 0xDDD0, 0xDDD0, 0x0002, 0xDDCF, 0xDDD0, 0xDDD0, 0x0000, 0xE5F0, 0xBCCC,
+0xD56F, 0xD56E, 0xD56E, 0x0002, 0xD58F, 0xDDCF, 0xDDD0, 0xDDD0, 0x0002, 0xE610, 0xAC6C, 0x20E2, 0x0000, 0x0000, 0x0002, 0x6286,
+0xE5CF, 0xD56E, 0xD56E, 0x0000, 0xBCCC, 0xD56E, 0xD56F, 0xD56E, 0xD56E, 0x0001, 0x8516, 0x8516, 0x0008, 0x8D57, 0x5AC9, 0x630B,
+0x8D57, 0x8516, 0x8516, 0x0017, 0x8515, 0x9577, 0x2986, 0x0000, 0x0000, 0x0000, 0x8515, 0x8D36, 0x8516, 0x8516, 0x0013, 0x8D36,
+0x7452, 0x4A6A, 0x3208, 0xE5CF, 0xD58F, 0xDDAF, 0xDDD0, 0xD56F, 0xCD4E, 0xCD4E, 0x0000, 0xD58F, 0xDDD0, 0xDDD0, 0x0004, 0xD56F,
+0xC50E, 0xD56F, 0xD56F, 0x0000, 0xD58F, 0xDDB0, 0xDDD0, 0xDDD0, 0x0008, 0xD56F, 0xCD4E, 0xD56E, 0xD56E, 0x0000, 0xD56F, 0xDDD0,
+0xE5F0, 0xE5F0, 0x0000, 0xCD4E, 0xCD2E, 0xE5F0, 0xCD4E, 0xD58F, 0xE5F0, 0xDDD0, 0xDDD0, 0x0005, 0xEE31, 0xFEF3, 0x1061, 0xD58F,
+0x0000, 0x0000, 0x0002, 0x5A66, 0xEE51, 0xDDD0, 0xDDD0, 0x0000, 0xCD4E, 0xE5F0, 0xDDD0, 0xDDD0, 0x0002, 0x8516, 0x8516, 0x0008,
+0x8D57, 0x5A88, 0x632B, 0x8D57, 0x8516, 0x8516, 0x0017, 0x8515, 0x95B8, 0x0000, 0x0000, 0x0001, 0x63D0, 0x8D56, 0x8516, 0x8516,
+0x0013, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xEE30, 0xDDAF, 0xD58F, 0xC50D, 0xDDD0, 0xDDD0, 0x0007, 0xE5F0, 0xD58F, 0xD56F, 0xE5F0,
+0xDDD0, 0xDDD0, 0x000B, 0xE5F0, 0xDDD0, 0xDDAF, 0xD58F, 0xD56F, 0xC50E, 0xC50D, 0xBCCD, 0xD58F, 0xE5F0, 0xDDD0, 0xE5F0, 0xD58F,
+0xC50D, 0xDDB0, 0xE5F0, 0xDDD0, 0xDDD0, 0x0002, 0xEE31, 0x5A66, 0x0000, 0x0000, 0x0000, 0x41A4, 0xAC8C, 0x0000, 0x0000, 0x0001,
+0x5226, 0xEE31, 0xDDD0, 0xE5F0, 0xC50D, 0xE5F0, 0xDDD0, 0xDDD0, 0x0002, 0x8516, 0x8516, 0x0008, 0x8D36, 0x73CE, 0x7430, 0x8D36,
+0x8516, 0x8516, 0x0017, 0x8D36, 0x9597, 0x7452, 0x0882, 0x3208, 0x9DD9, 0x8D36, 0x8516, 0x8516, 0x0013, 0x8D36, 0x7452, 0x4A6A,
+0x3208, 0xF651, 0xE5F0, 0xC50E, 0xE5F0, 0xE5D0, 0xDDD0, 0xDDD0, 0x0005, 0xE5F0, 0xD56E, 0xD56F, 0xE5F0, 0xDDD0, 0xDDD0, 0x0005,
+0xD58F, 0xD56F, 0xD56F, 0x0006, 0xD58F, 0xDDD0, 0xDDD0, 0x0000, 0xE5F0, 0xD56F, 0xD56F, 0x0000, 0xE5F0, 0xDDD0, 0xDDD0, 0x0002,
+0xE5F0, 0xCD4E, 0xCD2E, 0xDDD0, 0xDDD0, 0x0002, 0xF671, 0x20E2, 0x0000, 0x0000, 0x0001, 0x4A05, 0x0020, 0x0000, 0x0000, 0x0000,
+0x49E5, 0xF651, 0xDDD0, 0xE5F0, 0xC50D, 0xE5F0, 0xDDD0, 0xDDD0, 0x0002, 0x8516, 0x8516, 0x0008, 0x8D36, 0x7C51, 0x7C72, 0x8D36,
+0x8516, 0x8516, 0x0016, 0x8D36, 0x7452, 0x4ACC, 0x532D, 0x5B6E, 0x5B4E, 0x4ACC, 0x8D36, 0x8516, 0x8516, 0x0013, 0x8D36, 0x7452,
+0x4A6A, 0x3208, 0xEE10, 0xCD2E, 0xCD2E, 0x0000, 0xCD4E, 0xCD4E, 0x0002, 0xD56F, 0xD58F, 0xDDAF, 0xDDB0, 0xE5F0, 0xCD4E, 0xCD4E,
+0x0000, 0xDDAF, 0xD56F, 0xD56E, 0xD56E, 0x0000, 0xD56F, 0xD56F, 0x0002, 0xD58F, 0xDDAF, 0xDDD0, 0xDDD0, 0x0009, 0xE5F0, 0xBCCD,
+0xE5F0, 0xDDD0, 0xDDD0, 0x0001, 0xE5F0, 0xD58F, 0xCD4E, 0xCD4E, 0x0000, 0xD56E, 0xD56F, 0xD56E, 0xD56E, 0x0001, 0xE5F0, 0x0840,
+0x0000, 0x0000, 0x0001, 0x6286, 0x0000, 0x0000, 0x0001, 0x3984, 0xE5D0, 0xCD4E, 0xCD4E, 0x0002, 0xCD6E, 0xCD4E, 0xD56F, 0xDDAF,
+0x8516, 0x8516, 0x0008, 0x8D36, 0x7C92, 0x7C93, 0x8D36, 0x8516, 0x8516, 0x0016, 0x95B8, 0x0861, 0x0000, 0x0000, 0x0003, 0x6BF0,
+0x8D56, 0x8516, 0x8516, 0x0012, 0x8D36, 0x7452, 0x4A6A, 0x31E8, 0xE5F0, 0xE5F0, 0x0001, 0xDDD0, 0xDDD0, 0x0003, 0xDDAF, 0xD58F,
+0xD58F, 0x0000, 0xC50D, 0xC50D, 0x0000, 0xBCCD, 0xC50E, 0xDDAF, 0xE5F0, 0xE5F0, 0x0001, 0xDDD0, 0xDDD0, 0x000E, 0xDDAF, 0xC50D,
+0xE5F0, 0xDDAF, 0xCD4E, 0xCD4E, 0x0001, 0xD58F, 0xDDD0, 0xDDD0, 0x0005, 0xF672, 0x0000, 0x0000, 0x0002, 0x6287, 0x0000, 0x0000,
+0x0001, 0x3964, 0xF651, 0xDDD0, 0xDDD0, 0x0005, 0xD58F, 0x8516, 0x8516, 0x0008, 0x8536, 0x7C93, 0x7CB3, 0x8536, 0x8516, 0x8516,
+0x0015, 0x8D36, 0x7452, 0x0000, 0x0000, 0x0003, 0x0021, 0x8515, 0x9577, 0x8516, 0x8516, 0x0012, 0x8D36, 0x7452, 0x4A6A, 0x3208,
+0xF651, 0xDDD0, 0xDDD0, 0x0007, 0xE5F0, 0xC4ED, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xCD4E, 0xC50E, 0xC50E, 0x0000, 0xCD6E, 0xDDD0,
+0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x0009, 0xE5F0, 0xDDD0, 0xBCCD, 0xBCCD, 0x0000, 0xC50D, 0xCD4E, 0xDDD0, 0xE5F0, 0xE5F0,
+0x0001, 0xDDD0, 0xDDD0, 0x0004, 0xE5F0, 0xEE51, 0x0000, 0x0000, 0x0002, 0x5226, 0x0000, 0x0000, 0x0001, 0x2923, 0xF672, 0xE5F0,
+0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x0003, 0xE5F0, 0x8516, 0x8516, 0x0008, 0x8536, 0x84B4, 0x84D4, 0x8536, 0x8516, 0x8516, 0x0015,
+0x9598, 0x10C3, 0x0000, 0x10C3, 0x2186, 0x10E4, 0x4ACC, 0x29C7, 0x0000, 0x42AB, 0x8D77, 0x8516, 0x8516, 0x0011, 0x8D36, 0x7452,
+0x4A6A, 0x3208, 0xF631, 0xDDD0, 0xDDD0, 0x0006, 0xE5F0, 0xC50D, 0xDDAF, 0xDDD0, 0xDDD0, 0x0002, 0xE5F0, 0xE5F0, 0x0000, 0xDDAF,
+0xCD2E, 0xC50E, 0xC50E, 0x0000, 0xD58F, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x0003, 0xD58F, 0xCD4E, 0xCD4E, 0x0001, 0xD56F,
+0xDDD0, 0xDDD0, 0x0000, 0xD58F, 0xD56F, 0xCD4E, 0xCD4E, 0x0005, 0xD56F, 0xD56F, 0x0000, 0xCD4E, 0xCD2E, 0xBCCD, 0x0000, 0x0000,
+0x0002, 0x5A66, 0x0000, 0x0000, 0x0001, 0x18C2, 0xD54E, 0xC4ED, 0xCD2E, 0xCD6E, 0xD58F, 0xDDD0, 0xE5F0, 0xD58F, 0xC4ED, 0x8516,
+0x8516, 0x0009, 0x84D4, 0x84F5, 0x8516, 0x8516, 0x0013, 0x8536, 0x8D56, 0x8D77, 0x84D4, 0x632C, 0x7BEF, 0x734B, 0x62A9, 0x630B,
+0x6B6D, 0x5B2C, 0x4AEC, 0x10E4, 0x8D36, 0x8D36, 0x0000, 0x8516, 0x8516, 0x0010, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xF631, 0xDDD0,
+0xDDD0, 0x0005, 0xE5F0, 0xDDD0, 0xC4ED, 0xE610, 0xDDD0, 0xDDD0, 0x0008, 0xCD4E, 0xC4ED, 0xC4ED, 0x0000, 0xCD4E, 0xD58F, 0xCD2E,
+0xCD4E, 0xCD2E, 0xD58F, 0xE5F0, 0xDDD0, 0xDDD0, 0x000A, 0xE5F0, 0xE5D0, 0xBCAC, 0xCD2E, 0xD56F, 0xD5AF, 0xE610, 0xB4CD, 0x93CA,
+0x7B29, 0x72E8, 0x62A7, 0x0000, 0x0000, 0x0001, 0x1081, 0xF672, 0xDDB0, 0xD56F, 0xCD4E, 0xC50D, 0xBCCD, 0xB46C, 0xC4ED, 0xE5F0,
+0x8516, 0x8516, 0x0006, 0x8515, 0x8516, 0x8516, 0x0000, 0x84F5, 0x8515, 0x8516, 0x8516, 0x0012, 0x8D57, 0x8D36, 0x738D, 0x6246,
+0x5A05, 0x6226, 0x5A26, 0x6246, 0x5205, 0x49A4, 0x49A4, 0x0002, 0x5A88, 0x73CF, 0x8D77, 0x8D36, 0x8516, 0x8516, 0x000F, 0x8D36,
+0x7452, 0x4A6A, 0x3208, 0xF631, 0xDDD0, 0xDDD0, 0x0001, 0xE5F0, 0xE5F0, 0x0001, 0xD56F, 0xBCED, 0xB48C, 0xAC6C, 0xCD2E, 0xCD4E,
+0xCD4E, 0x0007, 0xD56F, 0xD58F, 0xD56F, 0xBCCD, 0xC50E, 0xAC6C, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x000C, 0xE5F0, 0xD58F,
+0xB48C, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x0001, 0xE5F0, 0xEE10, 0xF651, 0xA42B, 0x0000, 0x2923, 0x20E2, 0x18C2, 0x3164,
+0xEE51, 0xDDD0, 0xDDD0, 0x0001, 0xE5F0, 0xE5F0, 0x0001, 0xB46C, 0xE5F0, 0x8516, 0x8516, 0x0006, 0x8515, 0x8516, 0x8516, 0x0000,
+0x84F5, 0x8515, 0x8516, 0x8516, 0x0000, 0x8515, 0x8516, 0x8516, 0x000D, 0x8536, 0x8D77, 0x73CF, 0x5A05, 0x5A26, 0x6246, 0x6247,
+0x6247, 0x0001, 0x6267, 0x5206, 0x49C5, 0x49C5, 0x0003, 0x4984, 0x49C5, 0x7C51, 0x8D77, 0x8516, 0x8516, 0x000E, 0x8D36, 0x7452,
+0x4A6A, 0x3208, 0xF651, 0xE5F0, 0xE5F0, 0x0000, 0xD58F, 0xC50D, 0xB48C, 0xB48C, 0x0000, 0xC50E, 0xD5AF, 0xE5F0, 0xDDD0, 0xBCCD,
+0xC50D, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x0002, 0xE5F0, 0xE5F0, 0x0000, 0xDDAF, 0xC50D, 0xCD2E, 0xE5F0, 0xE5F0, 0x0000,
+0xD58F, 0xAC6C, 0xE5F0, 0xDDD0, 0xDDD0, 0x000B, 0xE5F0, 0xCD4E, 0xBCCD, 0xE5F0, 0xDDD0, 0xDDD0, 0x0006, 0xEE11, 0xF651, 0x0840,
+0x8BAA, 0x7308, 0xFE92, 0xDDD0, 0xDDD0, 0x0004, 0xE5F0, 0xB4AC, 0xDDB0, 0x8516, 0x8516, 0x0006, 0x8515, 0x8516, 0x8516, 0x0000,
+0x8515, 0x8516, 0x8516, 0x0009, 0x8515, 0x8516, 0x8D36, 0x8D56, 0x8516, 0x8516, 0x0000, 0x8D36, 0x8D57, 0x8D57, 0x0000, 0x6288,
+0x5A05, 0x6247, 0x6247, 0x0004, 0x6267, 0x5206, 0x49C5, 0x49C5, 0x0005, 0x4163, 0x62EA, 0x8D98, 0x8D56, 0x8D36, 0x8516, 0x8516,
+0x0000, 0x8D56, 0x8D36, 0x8516, 0x8515, 0x8516, 0x8516, 0x0005, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xDD8F, 0xB48C, 0xAC6C, 0xBCED,
+0xD56F, 0xE5F0, 0xE5F0, 0x0001, 0xDDD0, 0xDDD0, 0x0001, 0xE5F0, 0xD58F, 0xB48C, 0xC52E, 0xE5F0, 0xE5D0, 0xE5D0, 0x0000, 0xE5F0,
+0xD56F, 0xBCED, 0xCD4E, 0xE5F0, 0xE5D0, 0xDDD0, 0xDDD0, 0x0000, 0xE5F0, 0xCD4E, 0xAC6C, 0xE610, 0xDDD0, 0xDDD0, 0x0006, 0xE5F0,
+0xE5F0, 0x0002, 0xC4ED, 0xCD2E, 0xE611, 0xDDD0, 0xDDD0, 0x0008, 0xE5F0, 0x0000, 0x7B28, 0x6287, 0xEE31, 0xDDD0, 0xDDD0, 0x0004,
+0xE5F0, 0xCD4E, 0xC50E, 0x8516, 0x8516, 0x0014, 0x8D36, 0x8D77, 0x8D77, 0x0000, 0x7C52, 0x6B8E, 0x8D98, 0x8D77, 0x84D4, 0x634D,
+0x49E6, 0x6226, 0x6247, 0x6247, 0x0005, 0x6267, 0x5206, 0x49C5, 0x49C5, 0x0006, 0x4984, 0x4A07, 0x632D, 0x84D4, 0x8D77, 0x8D98,
+0x6B8E, 0x7452, 0x8D77, 0x8D77, 0x0000, 0x8D36, 0x8516, 0x8516, 0x0004, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xDD8F, 0xDDD0, 0xE5F0,
+0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x0007, 0xE5F0, 0xCD4E, 0xAC6C, 0xD56F, 0xCD2E, 0xBCCD, 0xD56F, 0xE5F0, 0xDDD0, 0xDDD0, 0x0004,
+0xE5F0, 0xBCED, 0xB4AC, 0xE610, 0xDDD0, 0xDDD0, 0x0000, 0xE5F0, 0xE5F0, 0x0002, 0xD58F, 0xC52E, 0xB4AC, 0xAC6C, 0xB46C, 0xAC6C,
+0xB4AC, 0xBCCD, 0xD56F, 0xE5F0, 0xE5F0, 0x0001, 0xDDD0, 0xDDD0, 0x0004, 0xE5F0, 0x7308, 0xB4AD, 0xAC6C, 0xE5F0, 0xDDD0, 0xDDD0,
+0x0005, 0xE5F0, 0xAC6C, 0x8516, 0x8516, 0x0012, 0x8536, 0x8D57, 0x7410, 0x5AAA, 0x3943, 0x3923, 0x3923, 0x0000, 0x5269, 0x49E6,
+0x5289, 0x7431, 0x95B8, 0x5A26, 0x6247, 0x6247, 0x0005, 0x6267, 0x5206, 0x49C5, 0x49C5, 0x0005, 0x49A5, 0x5A68, 0x95B9, 0x7431,
+0x5289, 0x49E6, 0x5289, 0x3923, 0x3923, 0x0000, 0x3943, 0x528A, 0x73F0, 0x8D56, 0x8D36, 0x8516, 0x8516, 0x0002, 0x8D36, 0x7452,
+0x4A6A, 0x3208, 0xF651, 0xDDD0, 0xDDD0, 0x000B, 0xE5F0, 0xE611, 0xA40B, 0xDDAF, 0xE5F0, 0xDDD0, 0xDDD0, 0x0007, 0xE610, 0xB48C,
+0xBCED, 0xE611, 0xD58F, 0xC52E, 0xB4AD, 0xAC4B, 0xAC6B, 0xBCCD, 0xCD2E, 0xDDAF, 0xE5F0, 0xE610, 0xB48C, 0xE611, 0xDDD0, 0xC50E,
+0xB48C, 0xB48C, 0x0000, 0xC50E, 0xDDD0, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x0002, 0xEE11, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0,
+0xDDD0, 0x0003, 0xE5F0, 0xE5F0, 0x0001, 0xD58F, 0xA42B, 0x8516, 0x8516, 0x0012, 0x8D36, 0x30E2, 0x3923, 0x3964, 0x4184, 0x4184,
+0x0000, 0x3964, 0x5248, 0x95B8, 0x8D57, 0x8D36, 0x8D57, 0x6B4C, 0x5A26, 0x6247, 0x6247, 0x0004, 0x6267, 0x5206, 0x49C5, 0x49C5,
+0x0005, 0x4984, 0x73EF, 0x8D56, 0x8D36, 0x8D57, 0x95B8, 0x5269, 0x3964, 0x4184, 0x4184, 0x0000, 0x3964, 0x3923, 0x30E2, 0x8515,
+0x8536, 0x8516, 0x8516, 0x0001, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xF631, 0xDDD0, 0xDDD0, 0x000B, 0xE5F0, 0xBCCD, 0xCD2E, 0xE5F0,
+0xDDD0, 0xDDD0, 0x0007, 0xE5F0, 0xE610, 0xCD2E, 0x93CA, 0x9BEA, 0xB4AC, 0xCD2E, 0xDDAF, 0xE5F0, 0xE5F0, 0x0002, 0xDDD0, 0xDDD0,
+0x0000, 0xE5F0, 0xAC4B, 0xE5F0, 0xDDD0, 0xE5F0, 0xE5F0, 0x0001, 0xCD4E, 0xB48C, 0xAC4B, 0xBCCD, 0xD58F, 0xE5F0, 0xE5F0, 0x0001,
+0xDDD0, 0xDDD0, 0x0002, 0xE5F0, 0xE5F0, 0x0000, 0xE610, 0xD58F, 0xC4ED, 0xAC4B, 0xA40B, 0xB4AC, 0xCD4E, 0x8516, 0x8516, 0x0012,
+0x8D77, 0x41A5, 0x41A5, 0x0003, 0x4185, 0x6BCF, 0x8D56, 0x8516, 0x8516, 0x0000, 0x8536, 0x84F5, 0x59E5, 0x6247, 0x6247, 0x0004,
+0x5A26, 0x51C4, 0x49A4, 0x49C5, 0x49C5, 0x0004, 0x49A4, 0x8D77, 0x8516, 0x8516, 0x0001, 0x8D56, 0x73F0, 0x4185, 0x41A5, 0x41A5,
+0x0002, 0x4184, 0x8D57, 0x8516, 0x8516, 0x0002, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xF631, 0xDDD0, 0xDDD0, 0x000B, 0xD58F, 0xAC4B,
+0xE610, 0xDDD0, 0xDDD0, 0x0006, 0xE5F0, 0xE610, 0xC50E, 0x9BEA, 0xB48C, 0xDDB0, 0xD58F, 0xB4AD, 0xB48C, 0xC52E, 0xE5F0, 0xE5F0,
+0x0001, 0xDDD0, 0xDDD0, 0x0001, 0xE5F0, 0xA42B, 0xE5F0, 0xDDD0, 0xDDD0, 0x0002, 0xE5F0, 0xE5F0, 0x0001, 0xD56F, 0xB4AD, 0xA42B,
+0xB48C, 0xCD2E, 0xE5F0, 0xE5F0, 0x0000, 0xE610, 0xDDD0, 0xC50E, 0xAC6C, 0x9C0B, 0xAC6C, 0xC50E, 0xDDAF, 0xE610, 0xE5F0, 0xE5F0,
+0x0000, 0x8516, 0x8516, 0x0012, 0x8536, 0x7C52, 0x7C72, 0x7C72, 0x0003, 0x7CB3, 0x8D36, 0x8516, 0x8516, 0x0000, 0x8515, 0x8D57,
+0x6B6C, 0x59E5, 0x5A05, 0x5A05, 0x0002, 0x51E4, 0x83AD, 0x94B2, 0x6B2B, 0x4184, 0x4163, 0x4163, 0x0002, 0x4142, 0x73F0, 0x8536,
+0x8515, 0x8516, 0x8516, 0x0000, 0x8D36, 0x7CB3, 0x7C72, 0x7C72, 0x0003, 0x7C52, 0x8516, 0x8516, 0x0003, 0x8D36, 0x7452, 0x4A6A,
+0x3208, 0xF631, 0xDDD0, 0xDDD0, 0x0008, 0xE5D0, 0xE5F0, 0xE610, 0x9BEA, 0xE5D0, 0xDDD0, 0xDDD0, 0x0005, 0xE5F0, 0xE610, 0xC50E,
+0x9BEA, 0xB4AC, 0xDDD0, 0xE5F0, 0xDDD0, 0xDDD0, 0x0000, 0xE5F0, 0xE5F0, 0x0000, 0xCD2E, 0xAC4C, 0xAC4B, 0xC50E, 0xE5F0, 0xE5F0,
+0x0002, 0xA44B, 0xDDAF, 0xDDD0, 0xDDD0, 0x0006, 0xE5F0, 0xE5F0, 0x0000, 0xDDAF, 0xBCED, 0xA42B, 0xAC6C, 0xA42B, 0xA42B, 0x0000,
+0xBCED, 0xD58F, 0xE5F0, 0xE5F0, 0x0001, 0xDDD0, 0xDDD0, 0x0002, 0x8516, 0x8516, 0x0012, 0x8536, 0x84D4, 0x7C93, 0x7C72, 0x7C72,
+0x0003, 0x84D4, 0x8515, 0x8516, 0x8D36, 0x9DB7, 0x9D97, 0x842F, 0x94B2, 0x94B2, 0x0000, 0x94F3, 0x9D55, 0x9D54, 0xCEFC, 0xBE59,
+0x9D35, 0xBE5A, 0xADD7, 0x9D34, 0x9D55, 0x9D14, 0x8C92, 0xAE3A, 0xA5B8, 0x8D36, 0x8516, 0x8515, 0x84D4, 0x7C72, 0x7C72, 0x0003,
+0x7C93, 0x84D4, 0x8536, 0x8516, 0x8516, 0x0002, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xF651, 0xDDD0, 0xE5F0, 0xE5F0, 0x0005, 0xDDD0,
+0xD5AF, 0xD56F, 0xCD4E, 0xAC4C, 0xCD4E, 0xE5F0, 0xDDD0, 0xDDD0, 0x0003, 0xE5F0, 0xE610, 0xC4ED, 0x9BEA, 0xBCCD, 0xE5F0, 0xE5F0,
+0x0000, 0xDDD0, 0xDDD0, 0x0004, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xC50E, 0xA40B, 0xA42B, 0xC50E, 0xE610, 0xB48C, 0xD56F, 0xE610,
+0xE5F0, 0xDDD0, 0xDDD0, 0x0007, 0xE5F0, 0xEE11, 0xB48C, 0xCD2E, 0xE610, 0xE5F0, 0xDDD0, 0xDDD0, 0x0006, 0x8516, 0x8516, 0x0013,
+0x8536, 0x8D36, 0x8536, 0x84F5, 0x84D4, 0x7CB3, 0x8516, 0x84F5, 0x84D4, 0x84D4, 0x0000, 0x84F5, 0x8536, 0x73CF, 0x73EF, 0x73EF,
+0x0002, 0x73CF, 0x73CF, 0x0000, 0x73AE, 0x6B8E, 0x6BAE, 0x6B8E, 0x6BAE, 0x6BAE, 0x0003, 0x7451, 0x8516, 0x84F5, 0x84D4, 0x84D4,
+0x0000, 0x84F5, 0x8536, 0x84B4, 0x84D4, 0x84F5, 0x8536, 0x8D36, 0x8536, 0x8516, 0x8516, 0x0003, 0x8D36, 0x7452, 0x4A6A, 0x3208,
+0xEE30, 0xD56F, 0xC52E, 0xBCED, 0xB48C, 0xAC4B, 0xA40B, 0xA40B, 0x0000, 0xA42B, 0xAC6C, 0xBCAD, 0x9C0B, 0x8B89, 0xBCCD, 0x9BCA,
+0xD56F, 0xE610, 0xDDD0, 0xDDD0, 0x0000, 0xE5F0, 0xE5F0, 0x0000, 0xBCED, 0x9BEA, 0xBCED, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xDDD0,
+0x0009, 0xE5F0, 0xE610, 0xDDD0, 0xBCCD, 0x9BEA, 0x9BEA, 0x0000, 0x93CA, 0xAC6C, 0xC50E, 0xDDD0, 0xE610, 0xE5F0, 0xE5F0, 0x0000,
+0xDDD0, 0xDDD0, 0x0004, 0xE5F0, 0xB4AC, 0xBCED, 0xE5F0, 0xDDD0, 0xDDD0, 0x0007, 0x8516, 0x8516, 0x0017, 0x8536, 0x8536, 0x0000,
+0x8516, 0x8516, 0x0003, 0x7C93, 0x7C10, 0x7C30, 0x7C30, 0x0005, 0x7C10, 0x7410, 0x7410, 0x0005, 0x73EF, 0x8515, 0x8515, 0x0000,
+0x8516, 0x8516, 0x0002, 0x8536, 0x8536, 0x0000, 0x8516, 0x8516, 0x0007, 0x8D36, 0x7452, 0x4A6A, 0x31E8, 0xAC4B, 0xAC6C, 0xBCAD,
+0xC50E, 0xCD6F, 0xDDAF, 0xE5F0, 0xEE31, 0xE610, 0xBCCD, 0x93CA, 0xBCCD, 0xE610, 0xE5F0, 0xE5D0, 0x9BEB, 0xAC4C, 0xE610, 0xE610,
+0x0000, 0xBCCD, 0x9BEB, 0xC50E, 0xE610, 0xE5F0, 0xDDD0, 0xDDD0, 0x000E, 0xE5F0, 0xEE31, 0x8B8A, 0xDDD0, 0xC52E, 0xB48C, 0x9BEA,
+0x93AA, 0xA44B, 0xBCED, 0xD58F, 0xE610, 0xE5F0, 0xE5F0, 0x0000, 0xDDD0, 0xDDD0, 0x0000, 0xE5F0, 0xBCCD, 0xB4AD, 0xE5F0, 0xDDD0,
+0xDDD0, 0x0007, 0x8516, 0x8516, 0x001D, 0x8D36, 0x7C51, 0x7C51, 0x0008, 0x7451, 0x7451, 0x0005, 0x7431, 0x84B4, 0x8536, 0x8516,
+0x8516, 0x000D, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xF671, 0xE5F0, 0xE5F0, 0x0002, 0xE610, 0xDDAF, 0xAC4C, 0x8B69, 0xBCCD, 0xE610,
+0xE5F0, 0xDDD0, 0xDDD0, 0x0001, 0xE610, 0xC50E, 0x93AA, 0xA42B, 0xCD6F, 0xE610, 0xE5F0, 0xDDD0, 0xDDD0, 0x0010, 0xE5F0, 0xB48C,
+0xB4AD, 0xE5F0, 0xE5F0, 0x0001, 0xE610, 0xE610, 0x0000, 0xD58F, 0xBCED, 0xA44C, 0x9BEA, 0xA42B, 0xBCCD, 0xD56F, 0xE5F0, 0xE610,
+0xC50E, 0xAC6C, 0xE5F0, 0xDDD0, 0xDDD0, 0x0007, 0x8516, 0x8516, 0x001D, 0x8515, 0x7C72, 0x7C92, 0x7C92, 0x0006, 0x7C72, 0x7C72,
+0x0007, 0x7C93, 0x8D36, 0x8516, 0x8516, 0x000D, 0x8D36, 0x7452, 0x4A6A, 0x3208, 0xF631, 0xDDD0, 0xDDD0, 0x0001, 0xCD2E, 0xA40B,
+0x93AA, 0xC50E, 0xE610, 0xE5F0, 0xDDD0, 0xDDD0, 0x0004, 0xE5F0, 0xDDD0, 0x93CA, 0xCD2E, 0xE5F0, 0xDDD0, 0xDDD0, 0x0011, 0xDDAF,
+0x8B8A, 0xE610, 0xDDD0, 0xDDD0, 0x0004, 0xE5F0, 0xE5F0, 0x0000, 0xE610, 0xE5F0, 0xCD4E, 0xBCCD, 0xAC6C, 0xAC6C, 0x0000, 0xAC4C,
+0xA44C, 0xE5F0, 0xDDD0, 0xDDD0, 0x0007,
 };
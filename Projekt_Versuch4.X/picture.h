@@ -1,9 +1,13 @@
+/* generated by tools/imgconv from Bild1.png - do not edit */
 #ifndef _PICTURE_H_
 
 #define _PICTURE_H_
 
+#define BILD1_WIDTH 140
+#define BILD1_HEIGHT 76
+#define BILD1_LENGTH 2901
+#define BILD1_CODEC 1 /* IMG_CODEC_RLE */
 
-extern const unsigned short Bild1[2593];
+extern const unsigned short Bild1[BILD1_LENGTH];
 
-
-#endif
\ No newline at end of file
+#endif
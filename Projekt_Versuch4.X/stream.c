@@ -0,0 +1,261 @@
+#define F_CPU 16000000UL
+#include <xc.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include "hal.h"
+#include "display.h"
+#include "timer.h"
+#include "prof.h"
+#include "stream.h"
+
+// Picture streaming over USART0 (see stream.h).
+// The receive interrupt only copies UDR0 into a 256 byte ring, which is
+// used as two halves: while the decoder empties one half, the UART fills
+// the other one, and an acknowledge byte gives a free half back to the
+// sender. So the UART input, the decoding and the SPI output of the
+// previous bytes all run at the same time, and the sender can never
+// overrun the buffer. The decoders are the ones of display.c, reading the
+// ring instead of flash.
+
+#if STREAM
+
+#if PROFILE || HAL_TRANSPORT_USART
+#error "STREAM needs USART0 for itself (PROFILE, HAL_TRANSPORT_USART)"
+#endif
+
+#define STREAM_UBRR (F_CPU / 8 / STREAM_BAUD - 1)
+
+static uint8_t buffer[STREAM_BUFFER]; // index wraps at 256 by itself
+static volatile uint8_t head;		  // written by the interrupt
+static uint8_t tail;
+static uint8_t timeout; // no data for STREAM_TIMEOUT_MS, rest of the frame is skipped
+static uint8_t palette[2 * 256]; // pal8/pal4, high/low byte pairs
+
+ISR(USART_RX_vect)
+{
+	buffer[head++] = UDR0;
+}
+
+void Stream_init(void)
+{
+	UBRR0 = STREAM_UBRR;
+	UCSR0A = (1 << U2X0);
+	UCSR0C = (1 << UCSZ01) | (1 << UCSZ00); // 8N1
+	UCSR0B = (1 << RXCIE0) | (1 << RXEN0) | (1 << TXEN0);
+}
+
+// next byte of the ring, waits for the UART if it is empty
+static uint8_t Stream_get(void)
+{
+	uint32_t start;
+	uint8_t data;
+
+	if (tail == head)
+	{
+		if (timeout)
+			return 0;
+		start = Timer_now();
+		while (tail == head)
+		{
+			if (Timer_now() - start > STREAM_TIMEOUT_MS)
+			{
+				timeout = 1;
+				return 0;
+			}
+		}
+	}
+	data = buffer[tail++];
+	if (!(tail & (STREAM_HALF - 1))) // a half is empty again
+	{
+		while (!(UCSR0A & (1 << UDRE0)))
+			;
+		UDR0 = STREAM_ACK;
+	}
+	return data;
+}
+
+static uint16_t Stream_getWord(void)
+{
+	uint16_t word = Stream_get() << 8;
+	return word | Stream_get();
+}
+
+static void Stream_raw(uint16_t length)
+{
+	while (length-- && !timeout)
+		Display_PutColour(Stream_getWord());
+}
+
+// "repeat pair + count", as Display_DrawRLE
+static void Stream_rle(uint16_t length)
+{
+	uint16_t w = 0, next;
+	uint8_t pending = 0;
+
+	while (length-- && !timeout)
+	{
+		next = Stream_getWord();
+		if (pending && next == w && length)
+		{
+			length--;
+			Display_RepeatColour(w, Stream_getWord() + 2);
+			pending = 0;
+		}
+		else
+		{
+			if (pending)
+				Display_PutColour(w);
+			w = next;
+			pending = 1;
+		}
+	}
+	if (pending)
+		Display_PutColour(w);
+}
+
+// palette of pal8/pal4 into RAM, returns the bytes it used
+static uint16_t Stream_palette(void)
+{
+	uint16_t n = Stream_get() + 1, i;
+	for (i = 0; i < 2 * n; i++)
+		palette[i] = Stream_get();
+	return 1 + 2 * n;
+}
+
+// as Display_DrawPal8
+static void Stream_pal8(uint16_t length)
+{
+	uint8_t token, n;
+	const uint8_t *c;
+
+	length -= Stream_palette();
+	while ((int16_t)length > 0 && !timeout)
+	{
+		token = Stream_get();
+		if (token & 0x80)
+		{
+			c = palette + 2 * Stream_get();
+			Display_RepeatColour((c[0] << 8) | c[1], (token & 0x7F) + 2);
+			length -= 2;
+		}
+		else
+		{
+			length -= token + 2;
+			for (n = token + 1; n; n--)
+			{
+				c = palette + 2 * Stream_get();
+				Display_PutColour((c[0] << 8) | c[1]);
+			}
+		}
+	}
+}
+
+// as Display_DrawPal4
+static void Stream_pal4(uint16_t length)
+{
+	uint8_t token;
+	const uint8_t *c;
+
+	length -= Stream_palette();
+	while ((int16_t)length > 0 && !timeout)
+	{
+		token = Stream_get();
+		length--;
+		c = palette + 2 * (token & 0x0F);
+		if (token < 0x10)
+			Display_PutColour((c[0] << 8) | c[1]);
+		else
+			Display_RepeatColour((c[0] << 8) | c[1], (token >> 4) + 1);
+	}
+}
+
+// as Display_DrawRGB332
+static void Stream_rgb332(uint16_t length)
+{
+	uint8_t token, n;
+
+	while ((int16_t)length > 0 && !timeout)
+	{
+		token = Stream_get();
+		if (token & 0x80)
+		{
+			Display_RepeatColour(RGB332_TO_565(Stream_get()), (token & 0x7F) + 2);
+			length -= 2;
+		}
+		else
+		{
+			length -= token + 2;
+			for (n = token + 1; n; n--)
+				Display_PutColour(RGB332_TO_565(Stream_get()));
+		}
+	}
+}
+
+// Wait for the next frame and draw it as it comes in. The core sleeps
+// until the first byte arrives.
+uint8_t Stream_run(void)
+{
+	uint8_t codec, w, h;
+	int16_t x, y;
+	uint16_t length;
+
+	set_sleep_mode(SLEEP_MODE_IDLE);
+	do
+	{
+		cli();
+		while (tail == head)
+		{
+			sleep_enable();
+			sei(); // the instruction after sei runs before any interrupt
+			sleep_cpu();
+			sleep_disable();
+			cli();
+		}
+		sei();
+		timeout = 0;
+		while (Stream_get() != STREAM_MAGIC0 && !timeout) // resync on the magic
+			;
+	} while (timeout || Stream_get() != STREAM_MAGIC1 || timeout);
+
+	codec = Stream_get();
+	x = Stream_get();
+	y = Stream_get();
+	w = Stream_get();
+	h = Stream_get();
+	length = Stream_get();
+	length |= Stream_get() << 8;
+	if (timeout)
+		return STREAM_TIMEOUT;
+	if (x == STREAM_CENTRE)
+		x = (DISPLAY_WIDTH - w) / 2;
+	if (y == STREAM_CENTRE)
+		y = (DISPLAY_HEIGHT - h) / 2;
+	if (codec > IMG_CODEC_RGB332)
+		return STREAM_BAD_CODEC;
+	if (!Display_SetWindow(x, y, w, h))
+		return STREAM_BAD_WINDOW;
+
+	SPI_begin();
+	switch (codec)
+	{
+	case IMG_CODEC_RAW:
+		Stream_raw(length);
+		break;
+	case IMG_CODEC_RLE:
+		Stream_rle(length);
+		break;
+	case IMG_CODEC_PAL8:
+		Stream_pal8(length);
+		break;
+	case IMG_CODEC_PAL4:
+		Stream_pal4(length);
+		break;
+	case IMG_CODEC_RGB332:
+		Stream_rgb332(length);
+		break;
+	}
+	SPI_end();
+	return timeout ? STREAM_TIMEOUT : STREAM_OK;
+}
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef _STREAM_H_
+
+#define _STREAM_H_
+
+#include <stdint.h>
+
+// Pictures streamed over USART0 (RXD0 PD0, TXD0 PD1), built with -DSTREAM=1.
+// tools/imgconv -s writes a frame, tools/imgstream sends it.
+
+#ifndef STREAM
+#define STREAM 0
+#endif
+
+#define STREAM_BAUD 1000000	  // U2X0, UBRR0 = 1: exact at 16 MHz
+#define STREAM_BUFFER 256	  // receive buffer, two halves
+#define STREAM_HALF (STREAM_BUFFER / 2)
+#define STREAM_WINDOW (STREAM_BUFFER - 1) // bytes in flight, a full ring would look empty
+#define STREAM_ACK 0x2B		  // '+': another half of the buffer is free
+#define STREAM_TIMEOUT_MS 500 // a frame is dropped after this long without data
+
+// Frame: 'S' '6' codec x y w h length (u16 little endian), then the table
+// of tools/imgconv: length entries, words (raw, rle) high byte first, bytes
+// (pal8, pal4, rgb332) as they are. x or y == STREAM_CENTRE: centred on the screen.
+// Flow control: the sender starts with STREAM_WINDOW bytes of credit and
+// gets STREAM_HALF more for every STREAM_ACK.
+#define STREAM_MAGIC0 'S'
+#define STREAM_MAGIC1 '6'
+#define STREAM_HEADER 9
+#define STREAM_CENTRE 0xFF
+
+// Stream_run results
+#define STREAM_OK 0
+#define STREAM_TIMEOUT 1 // sender stopped in the middle of a frame
+#define STREAM_BAD_CODEC 2
+#define STREAM_BAD_WINDOW 3 // picture not completely on the screen
+
+void Stream_init(void);
+uint8_t Stream_run(void);
+
+#endif
@@ -0,0 +1,232 @@
+#include "hal.h"
+#include "display.h"
+#include "text.h"
+
+// Text renderer for the 1 bit fonts of font.h.
+// A run of characters goes out as one window over all of them: the pixel
+// rows of the window are built from the glyph bits of every character in
+// turn, so a whole string line costs 6 command words and no per pixel
+// addressing. Foreground and background are split into their bus bytes once
+// per call, every font bit then only picks one of the two.
+// Strings are cut to the characters that fit completely on the screen, a
+// line that does not fit vertically is not drawn.
+
+static uint8_t text_fg[2], text_bg[2]; // bus bytes of the colours
+static uint8_t text_wide;			   // 2 bytes per pixel (16 bit mode)
+
+static void Text_colours(const TextStyle *style)
+{
+	text_wide = (display_colours != DISPLAY_COLOURS_8);
+	if (text_wide)
+	{
+		text_fg[0] = style->fg >> 8;
+		text_fg[1] = style->fg;
+		text_bg[0] = style->bg >> 8;
+		text_bg[1] = style->bg;
+	}
+	else
+	{
+		text_fg[0] = RGB565_TO_332(style->fg);
+		text_bg[0] = RGB565_TO_332(style->bg);
+	}
+}
+
+// n pixels of the foreground (on) or the background colour
+static inline void Text_pixels(uint8_t on, uint8_t n)
+{
+	const uint8_t *c = on ? text_fg : text_bg;
+	do
+	{
+		SPIPut8Bit(c[0]);
+		if (text_wide)
+			SPIPut8Bit(c[1]);
+	} while (--n);
+}
+
+uint8_t Text_cellWidth(const TextStyle *style)
+{
+	return (style->font->width + style->font->spacing) * style->scale;
+}
+
+uint8_t Text_cellHeight(const TextStyle *style)
+{
+	return style->font->height * style->scale;
+}
+
+// characters of s that fit from x to the right edge, at most max
+static uint8_t Text_fit(uint8_t x, const char *s, uint8_t max, const TextStyle *style)
+{
+	uint8_t n = 0, fit;
+
+	if (x >= DISPLAY_WIDTH)
+		return 0;
+	fit = (DISPLAY_WIDTH - x) / Text_cellWidth(style);
+	if (fit < max)
+		max = fit;
+	while (n < max && s[n])
+		n++;
+	return n;
+}
+
+// Pixels of n characters into the open window, row by row
+static void Text_run(const char *s, uint8_t n, const TextStyle *style)
+{
+	const Font *f = style->font;
+	const uint8_t *g;
+	uint8_t row, mask, rep, k, col, index;
+	uint8_t space = f->spacing * style->scale;
+
+	for (row = 0, mask = 1; row < f->height; row++, mask <<= 1)
+		for (rep = style->scale; rep; rep--)
+			for (k = 0; k < n; k++)
+			{
+				index = (uint8_t)s[k] - f->first;
+				if (index < f->count)
+				{
+					g = f->glyphs + index * f->width;
+					for (col = f->width; col; col--)
+						Text_pixels(*g++ & mask, style->scale);
+				}
+				else
+					Text_pixels(0, f->width * style->scale);
+				if (space)
+					Text_pixels(0, space);
+			}
+}
+
+// Draw s at (x, y) in one window. Returns the width in pixels.
+uint8_t Text_draw(uint8_t x, uint8_t y, const char *s, const TextStyle *style)
+{
+	uint8_t n = Text_fit(x, s, 0xFF, style);
+	uint8_t w = n * Text_cellWidth(style), h = Text_cellHeight(style);
+
+	if (!n || !Display_SetWindow(x, y, w, h)) // below the screen
+		return 0;
+	Text_colours(style);
+	SPI_begin();
+	Text_run(s, n, style);
+	SPI_end();
+	return w;
+}
+
+// A field of length characters at (x, y). Nothing is drawn yet, the first
+// TextField_set draws all of it.
+void TextField_init(TextField *f, uint8_t x, uint8_t y, uint8_t length, const TextStyle *style)
+{
+	f->style = style;
+	f->x = x;
+	f->y = y;
+	f->length = (length < TEXT_FIELD_MAX) ? length : TEXT_FIELD_MAX;
+	TextField_invalidate(f);
+}
+
+// Draw the whole field at the next TextField_set (e.g. after the background
+// was painted over it)
+void TextField_invalidate(TextField *f)
+{
+	uint8_t i;
+	for (i = 0; i < TEXT_FIELD_MAX; i++)
+		f->shown[i] = 0;
+}
+
+// Show s in the field, filled up with spaces, cut at the field length.
+// Every run of characters that differ from the ones on the screen is one
+// window, all of them in one SPI transaction. A counter that counts up by
+// one mostly sends a single character: 6 x 8 pixels with Font5x7 are 96
+// bytes plus 12 for the window, about 0.1 ms at fosc/2.
+// Returns the number of characters sent.
+uint8_t TextField_set(TextField *f, const char *s)
+{
+	char next[TEXT_FIELD_MAX];
+	uint8_t i, n, start, sent = 0;
+	uint8_t cw = Text_cellWidth(f->style), h = Text_cellHeight(f->style);
+
+	if (f->x >= DISPLAY_WIDTH || f->y + h > DISPLAY_HEIGHT)
+		return 0;
+	n = (DISPLAY_WIDTH - f->x) / cw;
+	if (n > f->length)
+		n = f->length;
+	for (i = 0; i < n; i++)
+		next[i] = *s ? *s++ : ' ';
+
+	for (i = 0; i < n;)
+	{
+		if (next[i] == f->shown[i])
+		{
+			i++;
+			continue;
+		}
+		if (!sent)
+		{
+			Text_colours(f->style);
+			SPI_begin();
+		}
+		for (start = i; i < n && next[i] != f->shown[i]; i++)
+			f->shown[i] = next[i];
+		Display_OpenWindow(f->x + start * cw, f->y, (i - start) * cw, h);
+		Text_run(f->shown + start, i - start, f->style);
+		sent += i - start;
+	}
+	if (sent)
+		SPI_end();
+	return sent;
+}
+
+// powers of ten for Text_formatFixed, const in flash
+static const uint32_t text_pow10[10] = {1000000000, 100000000, 10000000, 1000000, 100000,
+										10000, 1000, 100, 10, 1};
+
+// value / 10^decimals as text, e.g. 1234 with 2 decimals is "12.34", right
+// aligned in width characters (0: as long as needed). A number that does
+// not fit is shown as width x '#'. buf needs width + 1 characters,
+// TEXT_NUMBER_MAX + 1 with width 0.
+// The digits come from subtracting the powers of ten, at most 9 times per
+// digit: the AVR has no divider and a 32 bit division of libgcc costs
+// several hundred cycles per digit.
+char *Text_formatFixed(char *buf, int32_t value, uint8_t decimals, uint8_t width)
+{
+	char digits[TEXT_NUMBER_MAX];
+	uint32_t u = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+	uint32_t p;
+	uint8_t n = 0, k, pos, started = 0, i;
+	char d;
+
+	if (decimals > 9)
+		decimals = 9;
+	if (value < 0)
+		digits[n++] = '-';
+	for (k = 0; k < 10; k++)
+	{
+		p = text_pow10[k];
+		for (d = '0'; u >= p; d++)
+			u -= p;
+		pos = 9 - k; // decimal place of this digit in value
+		if (d != '0' || started || pos <= decimals)
+		{
+			digits[n++] = d;
+			started = 1;
+		}
+		if (pos == decimals && decimals)
+			digits[n++] = '.';
+	}
+
+	if (!width)
+		width = n;
+	if (n > width)
+		for (i = 0; i < width; i++)
+			buf[i] = '#';
+	else
+	{
+		for (i = 0; i < width - n; i++)
+			buf[i] = ' ';
+		for (k = 0; k < n; k++)
+			buf[i++] = digits[k];
+	}
+	buf[width] = 0;
+	return buf;
+}
+
+char *Text_formatInt(char *buf, int32_t value, uint8_t width)
+{
+	return Text_formatFixed(buf, value, 0, width);
+}
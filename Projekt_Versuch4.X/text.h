@@ -0,0 +1,40 @@
+#ifndef _TEXT_H_
+
+#define _TEXT_H_
+
+#include <stdint.h>
+#include "font.h"
+
+#define TEXT_FIELD_MAX 16  // characters of a TextField
+#define TEXT_NUMBER_MAX 12 // longest number of Text_formatFixed: sign, 10 digits, point
+
+typedef struct
+{
+	const Font *font;
+	uint16_t fg, bg; // RGB565
+	uint8_t scale;	 // 1..: every font pixel becomes scale x scale pixels
+} TextStyle;
+
+// Text at a fixed place that is redrawn often (readouts, counters).
+// TextField_set only sends the characters that differ from the ones on the
+// screen.
+typedef struct
+{
+	const TextStyle *style;
+	uint8_t x, y;
+	uint8_t length;				// characters
+	char shown[TEXT_FIELD_MAX]; // characters on the screen, 0: not drawn yet
+} TextField;
+
+uint8_t Text_draw(uint8_t x, uint8_t y, const char *s, const TextStyle *style);
+uint8_t Text_cellWidth(const TextStyle *style);
+uint8_t Text_cellHeight(const TextStyle *style);
+
+void TextField_init(TextField *f, uint8_t x, uint8_t y, uint8_t length, const TextStyle *style);
+void TextField_invalidate(TextField *f);
+uint8_t TextField_set(TextField *f, const char *s);
+
+char *Text_formatInt(char *buf, int32_t value, uint8_t width);
+char *Text_formatFixed(char *buf, int32_t value, uint8_t decimals, uint8_t width);
+
+#endif
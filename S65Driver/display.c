@@ -0,0 +1,573 @@
+#include "hal.h"
+#include "display.h"
+#include "prof.h"
+
+// S65 display driver (LS020 controller), only talks to the bus through hal.h
+
+// Profiling: the bytes on the bus are counted once per command sequence and
+// once per window, not per byte, so the counter does not slow down the SPI
+// path it measures. A window is always filled completely, its pixel bytes
+// are counted when it is set.
+#define PROF_WINDOW(w, h) PROF_SPI_BYTES((uint32_t)(w) * (h) * (display_colours == DISPLAY_COLOURS_8 ? 1 : 2))
+
+typedef struct
+{
+	int16_t x1, y1, x2, y2; // x1 <= x < x2, y1 <= y < y2
+} DisplayRect;
+
+// Send command sequence. The sequences are window and mode commands of a
+// few words, an 8 bit count keeps the length in one register (the first
+// version counted in 32 bit, 4 registers and carries on every step).
+void SendCommandSeq(const uint16_t *data, uint8_t Anzahl)
+{
+	PROF_SPI_BYTES(2 * Anzahl);
+	HAL_SetDC(1); // Data/Command auf High => Kommando-Modus
+	SPI_begin();  // one transaction for the whole sequence
+	SPIStream16Bit(data, Anzahl);
+	SPI_end();
+	HAL_SetDC(0); // Data/Command auf Low => Daten-Modus
+}
+
+// Orientation (DISPLAY_ROT_*) and the screen size that goes with it
+static uint8_t display_rot = DISPLAY_ORIENTATION;
+uint8_t display_width = (DISPLAY_ORIENTATION & 1) ? DISPLAY_LONG : DISPLAY_SHORT;
+uint8_t display_height = (DISPLAY_ORIENTATION & 1) ? DISPLAY_SHORT : DISPLAY_LONG;
+
+// Colour mode (DISPLAY_COLOURS_*), only with DISPLAY_RGB332. The LS020
+// switches with one command word on page 0xEF08, the values are the ones of
+// common LS020 drivers: 0xE800 RGB332, 0xE80F RGB565. Neither the datasheet
+// nor the original init confirm them, so the mode is opt-in.
+#define DISPLAY_CMD_COLOURS_8 0xE800
+#define DISPLAY_CMD_COLOURS_16 0xE80F
+
+#if DISPLAY_RGB332
+uint8_t display_colours = DISPLAY_COLOURS;
+#endif
+
+// Switch the orientation at runtime. Only what is drawn afterwards is
+// affected, the picture on the screen stays as it is.
+void Display_SetOrientation(uint8_t rot)
+{
+	display_rot = rot & 3;
+	if (display_rot & 1)
+	{
+		display_width = DISPLAY_LONG;
+		display_height = DISPLAY_SHORT;
+	}
+	else
+	{
+		display_width = DISPLAY_SHORT;
+		display_height = DISPLAY_LONG;
+	}
+}
+
+uint8_t Display_GetOrientation(void)
+{
+	return display_rot;
+}
+
+// Switch between 16 bit (2 bytes per pixel) and 8 bit colours (1 byte per
+// pixel). The picture on the screen stays, only new pixels use the new mode.
+// Without DISPLAY_RGB332 nothing is sent, the display stays in 16 bit mode.
+void Display_SetColours(uint8_t colours)
+{
+#if DISPLAY_RGB332
+	uint16_t cmd[2] = {0xEF08, 0};
+
+	cmd[1] = (colours == DISPLAY_COLOURS_8) ? DISPLAY_CMD_COLOURS_8 : DISPLAY_CMD_COLOURS_16;
+	SendCommandSeq(cmd, 2); // on the page where the init sends it
+	display_colours = colours;
+#else
+	(void)colours;
+#endif
+}
+
+// Window command words for the screen rectangle x, y, w, h in the current
+// orientation. The controller RAM is 132 x 176 (controller x 0..131,
+// y 0..175). The address mode picks the fast axis (0x04: controller y) and
+// the directions (0x01: controller x counts down, 0x02: y counts down), and
+// start/end of the window are given in the order the controller walks them.
+// So the pixels of every rectangle arrive line by line in screen order in
+// all orientations, nothing is transformed per pixel. The rectangle must
+// lie on the screen, the callers clip it.
+//   rot  mode  controller x   controller y
+//   0    0x00  x              y             (Versuch3)
+//   90   0x05  131 - y        x             (Versuch4)
+//   180  0x03  131 - x        175 - y
+//   270  0x06  y              175 - x
+void Display_WindowWords(uint16_t *window, uint8_t x, uint8_t y, uint8_t w, uint8_t h)
+{
+	uint8_t x2 = x + w - 1, y2 = y + h - 1;
+
+	window[0] = 0xEF08; // start, format, x1, y1, x2, y2
+	switch (display_rot)
+	{
+	case DISPLAY_ROT_0:
+		window[1] = 0x1800;
+		window[2] = 0x1200 | x;
+		window[3] = 0x1300 | y;
+		window[4] = 0x1500 | x2;
+		window[5] = 0x1600 | y2;
+		break;
+	case DISPLAY_ROT_90:
+		window[1] = 0x1805;
+		window[2] = 0x1200 | (uint8_t)(DISPLAY_SHORT - 1 - y);
+		window[3] = 0x1300 | x;
+		window[4] = 0x1500 | (uint8_t)(DISPLAY_SHORT - 1 - y2);
+		window[5] = 0x1600 | x2;
+		break;
+	case DISPLAY_ROT_180:
+		window[1] = 0x1803;
+		window[2] = 0x1200 | (uint8_t)(DISPLAY_SHORT - 1 - x);
+		window[3] = 0x1300 | (uint8_t)(DISPLAY_LONG - 1 - y);
+		window[4] = 0x1500 | (uint8_t)(DISPLAY_SHORT - 1 - x2);
+		window[5] = 0x1600 | (uint8_t)(DISPLAY_LONG - 1 - y2);
+		break;
+	default: // DISPLAY_ROT_270
+		window[1] = 0x1806;
+		window[2] = 0x1200 | y;
+		window[3] = 0x1300 | (uint8_t)(DISPLAY_LONG - 1 - x);
+		window[4] = 0x1500 | y2;
+		window[5] = 0x1600 | (uint8_t)(DISPLAY_LONG - 1 - x2);
+		break;
+	}
+}
+
+// Set the display window.
+// Pixel data sent afterwards fills the window line by line. The caller
+// streams w x h pixels, so the window cannot be clipped: a rectangle that is
+// not completely on the screen is rejected, nothing is sent and 0 returned.
+uint8_t Display_SetWindow(int16_t x, int16_t y, uint8_t w, uint8_t h)
+{
+	uint16_t window[6];
+
+	if (x < 0 || y < 0 || !w || !h || x + w > DISPLAY_WIDTH || y + h > DISPLAY_HEIGHT)
+		return 0;
+	Display_WindowWords(window, x, y, w, h);
+	SendCommandSeq(window, 6);
+	PROF_WINDOW(w, h);
+	return 1;
+}
+
+// Clip x, y, w, h to the screen. Returns 0 if nothing of it is visible,
+// else the visible part is in c.
+static uint8_t Display_Clip(int16_t x, int16_t y, uint8_t w, uint8_t h, DisplayRect *c)
+{
+	c->x1 = (x < 0) ? 0 : x;
+	c->y1 = (y < 0) ? 0 : y;
+	c->x2 = (x + w > DISPLAY_WIDTH) ? DISPLAY_WIDTH : x + w;
+	c->y2 = (y + h > DISPLAY_HEIGHT) ? DISPLAY_HEIGHT : y + h;
+	return c->x1 < c->x2 && c->y1 < c->y2;
+}
+
+// Set the display window inside an already open transaction, so several
+// windows and their pixels can go out as one stream (sprites, shapes).
+// D_C is high for the window words and low again for the pixel data.
+void Display_OpenWindow(uint8_t x, uint8_t y, uint8_t w, uint8_t h)
+{
+	uint16_t window[6];
+	Display_WindowWords(window, x, y, w, h);
+	PROF_SPI_BYTES(12);
+	PROF_WINDOW(w, h);
+	HAL_SetDC(1);
+	SPIStream16Bit(window, 6);
+	HAL_SetDC(0);
+}
+
+// count pixels of one colour inside an open transaction. In 8 bit mode
+// two pixels are one word of the unrolled SPIRepeat16Bit loop.
+void Display_RepeatColour(uint16_t colour, uint16_t count)
+{
+	uint8_t b;
+
+	if (display_colours != DISPLAY_COLOURS_8)
+	{
+		SPIRepeat16Bit(colour, count);
+		return;
+	}
+	b = RGB565_TO_332(colour);
+	SPIRepeat16Bit((b << 8) | b, count >> 1);
+	if (count & 1)
+		SPIPut8Bit(b);
+}
+
+// Fill a w x h rectangle with one colour.
+// The colour is split into high/low byte once and streamed in one SPI
+// transaction. At fosc/2 a pixel costs about 36 cycles (2 bytes a 16 cycles
+// plus SPIF polling), i.e. about 36000 cycles (2.3 ms) per 1000 pixels plus
+// about 250 cycles for the window. The old per-pixel SPISend16Bit loop
+// needed about 100000 cycles per 1000 pixels. In 8 bit mode it is half.
+// The rectangle is clipped to the screen.
+void Display_FillRect(int16_t x, int16_t y, uint8_t w, uint8_t h, uint16_t colour)
+{
+	DisplayRect c;
+
+	if (!Display_Clip(x, y, w, h, &c))
+		return;
+	PROF_BEGIN(PROF_SEC_FILL);
+	Display_SetWindow(c.x1, c.y1, c.x2 - c.x1, c.y2 - c.y1);
+	SPI_begin();
+	Display_RepeatColour(colour, (uint16_t)(c.x2 - c.x1) * (c.y2 - c.y1));
+	SPI_end();
+	PROF_END(PROF_SEC_FILL);
+}
+
+// Display initialization as byte code (const, stays in flash):
+//   INIT_CMD(n), n words     send n command words
+//   INIT_DELAY(ms)           pause, Display_initStep returns to the caller
+//   INIT_RESET(level)        reset line of the display
+//   INIT_END
+#define INIT_CMD(n) (n) // 1..63 words
+#define INIT_DELAY(ms) 0x40, ((ms) >> 8), ((ms) & 0xFF)
+#define INIT_RESET(level) (0x80 | (level))
+#define INIT_END 0xFF
+#define W(word) ((word) >> 8), ((word) & 0xFF)
+
+// The pauses of the first version (300 ms + 7 x 75 ms) were far longer than
+// the controller needs. The short ones are the values common LS020 drivers
+// use, DISPLAY_SLOW_INIT brings back the old ones for a panel that does not
+// start with them.
+#ifdef DISPLAY_SLOW_INIT
+#define INIT_MS(fast, slow) (slow)
+#else
+#define INIT_MS(fast, slow) (fast)
+#endif
+
+static const uint8_t InitCode[] = {
+	INIT_DELAY(INIT_MS(0, 300)),
+	INIT_RESET(0), // Beginn Hardware-Reset
+	INIT_DELAY(INIT_MS(10, 225)),
+	INIT_RESET(1), // Ende Hardware-Reset
+	INIT_DELAY(INIT_MS(10, 75)),
+	// Initialisierungsdaten fuer 16-Bit-Farben Modus
+	INIT_CMD(2), W(0xFDFD), W(0xFDFD),
+	INIT_DELAY(INIT_MS(50, 75)),
+	INIT_CMD(10),
+	W(0xEF00), W(0xEE04), W(0x1B04), W(0xFEFE), W(0xFEFE),
+	W(0xEF90), W(0x4A04), W(0x7F3F), W(0xEE04), W(0x4306),
+	INIT_DELAY(INIT_MS(10, 75)),
+	INIT_CMD(23),
+	W(0xEF90), W(0x0983), W(0x0800), W(0x0BAF), W(0x0A00),
+	W(0x0500), W(0x0600), W(0x0700), W(0xEF00), W(0xEE0C),
+	W(0xEF90), W(0x0080), W(0xEFB0), W(0x4902), W(0xEF00),
+	W(0x7F01), W(0xE181), W(0xE202), W(0xE276), W(0xE183),
+	W(0x8001), W(0xEF90), W(0x0000),
+	INIT_DELAY(INIT_MS(10, 75)),
+	// whole screen as window in the orientation the project starts with
+	INIT_CMD(6),
+#if DISPLAY_ORIENTATION == DISPLAY_ROT_90
+	W(0xEF08), W(0x1805), W(0x1283), W(0x1500), W(0x1300),
+	W(0x16AF), // Querformat 176 x 132 Pixel
+#elif DISPLAY_ORIENTATION == DISPLAY_ROT_180
+	W(0xEF08), W(0x1803), W(0x1283), W(0x1500), W(0x13AF),
+	W(0x1600), // Hochformat upside down
+#elif DISPLAY_ORIENTATION == DISPLAY_ROT_270
+	W(0xEF08), W(0x1806), W(0x1200), W(0x1583), W(0x13AF),
+	W(0x1600), // Querformat upside down
+#else
+	W(0xEF08), W(0x1800), W(0x1200), W(0x1583), W(0x1300),
+	W(0x16AF), // Hochformat 132 x 176 Pixel
+#endif
+#if DISPLAY_COLOURS == DISPLAY_COLOURS_8
+	INIT_CMD(1), W(DISPLAY_CMD_COLOURS_8), // 8-Bit-Farben RGB332
+#endif
+	INIT_END};
+
+static const uint8_t *init_pc; // next byte code of the running init
+
+// Start the display initialisation, the steps follow with Display_initStep.
+void Display_initStart(void)
+{
+	init_pc = InitCode;
+#if DISPLAY_RGB332
+	display_colours = DISPLAY_COLOURS;
+#endif
+}
+
+// Run the init byte code up to the next pause. Returns the pause in ms the
+// caller has to let pass before the next call (and may use for other work),
+// DISPLAY_INIT_DONE when the display is ready.
+uint16_t Display_initStep(void)
+{
+	uint8_t op, n;
+	uint16_t ms;
+
+	while (1)
+	{
+		op = *init_pc++;
+		if (op == INIT_END)
+		{
+			init_pc--;
+			return DISPLAY_INIT_DONE;
+		}
+		if (op & 0x80)
+			HAL_SetReset(op & 0x01);
+		else if (op & 0x40)
+		{
+			ms = *init_pc++ << 8;
+			ms |= *init_pc++;
+			if (ms)
+				return ms;
+		}
+		else
+		{
+			PROF_SPI_BYTES(2 * op);
+			HAL_SetDC(1); // Data/Command auf High => Kommando-Modus
+			SPI_begin();
+			for (n = op; n; n--)
+			{
+				SPIPut8Bit(*init_pc++);
+				SPIPut8Bit(*init_pc++);
+			}
+			SPI_end();
+			HAL_SetDC(0); // Data/Command auf Low => Daten-Modus
+		}
+	}
+}
+
+// Display initialization (blocking)
+void Display_init(void)
+{
+	uint16_t ms;
+	PROF_BEGIN(PROF_SEC_INIT);
+	Display_initStart();
+	while ((ms = Display_initStep()) != DISPLAY_INIT_DONE)
+		Waitms(ms);
+	PROF_END(PROF_SEC_INIT);
+}
+
+// Clipping of Display_DrawImage for a picture partly off the screen.
+// The window is only the visible part, the decoders still run over the whole
+// picture and Display_ImagePut / Display_ImageRun drop the pixels outside of
+// it. A picture on the screen takes the direct path, its only extra cost is
+// the test of image_clip per pixel or run.
+static uint8_t image_clip;			 // 1: clipped picture being drawn
+static uint8_t image_w;				 // width of the picture
+static uint8_t image_x1, image_x2;	 // visible columns of the picture
+static uint8_t image_y1, image_y2;	 // visible rows of the picture
+static uint8_t image_col, image_row; // position of the next pixel in it
+
+// count pixels of one colour at the current position of the clipped picture
+static void Display_ClipRun(uint16_t colour, uint16_t count)
+{
+	uint8_t n, a, b;
+
+	while (count)
+	{
+		n = image_w - image_col;
+		if (n > count)
+			n = count;
+		if (image_row >= image_y1 && image_row < image_y2)
+		{
+			a = (image_col > image_x1) ? image_col : image_x1;
+			b = (image_col + n < image_x2) ? image_col + n : image_x2;
+			if (a < b)
+				Display_RepeatColour(colour, b - a);
+		}
+		count -= n;
+		image_col += n;
+		if (image_col == image_w)
+		{
+			image_col = 0;
+			image_row++;
+		}
+	}
+}
+
+HAL_INLINE void Display_ImagePut(uint16_t colour)
+{
+	if (image_clip)
+		Display_ClipRun(colour, 1);
+	else
+		Display_PutColour(colour);
+}
+
+HAL_INLINE void Display_ImageRun(uint16_t colour, uint16_t count)
+{
+	if (image_clip)
+		Display_ClipRun(colour, count);
+	else
+		Display_RepeatColour(colour, count);
+}
+
+// Stream an uncompressed picture into the open window
+void Display_DrawRaw(const uint16_t *data, uint16_t length)
+{
+	HalFlash src = HAL_FLASH(data);
+
+	SPI_begin();
+	if (display_colours == DISPLAY_COLOURS_8 || image_clip)
+		while (length--)
+			Display_ImagePut(HAL_ReadFlash16(&src));
+	else
+		SPIStream16Bit(data, length);
+	SPI_end();
+}
+
+// Decode a picture compressed with the "repeat pair + count" scheme and
+// stream it into the open window: two equal words w, w followed by n mean
+// n + 2 pixels of colour w, any other word is a single pixel.
+// data must be a const table in flash (read with HAL_ReadFlash16). It is read
+// once, front to back, and decoding stops after length words. The last word
+// stays in w until the next one shows whether it starts a run, a run goes
+// out as one SPIRepeat16Bit burst.
+void Display_DrawRLE(const uint16_t *data, uint16_t length)
+{
+	HalFlash src = HAL_FLASH(data);
+	HalFlash end = HAL_FLASH(data + length);
+	uint16_t w = 0;		 // word waiting for its successor
+	uint16_t next;
+	uint8_t pending = 0; // w holds an unsent word
+
+	SPI_begin();
+	while (src < end)
+	{
+		next = HAL_ReadFlash16(&src);
+		if (pending && next == w && src < end)
+		{
+			Display_ImageRun(w, HAL_ReadFlash16(&src) + 2);
+			pending = 0;
+		}
+		else
+		{
+			if (pending)
+				Display_ImagePut(w);
+			w = next;
+			pending = 1;
+		}
+	}
+	if (pending)
+		Display_ImagePut(w);
+	SPI_end();
+}
+
+// Palette picture with 8 bit indices (IMG_CODEC_PAL8):
+// data[0] = number of colours - 1, then the palette as high/low byte pairs,
+// then tokens: b < 0x80 => b + 1 literal indices follow,
+// b >= 0x80 => (b & 0x7F) + 2 pixels of the index that follows.
+// The colours are stored pre-split, a literal pixel is one index read and
+// two palette reads that overlap with the previous byte on the bus.
+void Display_DrawPal8(const uint8_t *data, uint16_t length)
+{
+	const uint8_t *pal = data + 1;
+	const uint8_t *p = pal + 2 * ((uint16_t)data[0] + 1);
+	const uint8_t *end = data + length;
+	const uint8_t *c;
+	uint8_t token, n;
+
+	SPI_begin();
+	while (p < end)
+	{
+		token = *p++;
+		if (token & 0x80)
+		{
+			c = pal + 2 * *p++;
+			Display_ImageRun((c[0] << 8) | c[1], (token & 0x7F) + 2);
+		}
+		else
+		{
+			for (n = token + 1; n; n--)
+			{
+				c = pal + 2 * *p++;
+				Display_ImagePut((c[0] << 8) | c[1]);
+			}
+		}
+	}
+	SPI_end();
+}
+
+// Palette picture with up to 16 colours (IMG_CODEC_PAL4):
+// palette as for IMG_CODEC_PAL8, then one byte per run:
+// high nibble = length - 1, low nibble = index.
+void Display_DrawPal4(const uint8_t *data, uint16_t length)
+{
+	const uint8_t *pal = data + 1;
+	const uint8_t *p = pal + 2 * ((uint16_t)data[0] + 1);
+	const uint8_t *end = data + length;
+	const uint8_t *c;
+	uint8_t token;
+
+	SPI_begin();
+	while (p < end)
+	{
+		token = *p++;
+		c = pal + 2 * (token & 0x0F);
+		if (token < 0x10)
+			Display_ImagePut((c[0] << 8) | c[1]);
+		else
+			Display_ImageRun((c[0] << 8) | c[1], (token >> 4) + 1);
+	}
+	SPI_end();
+}
+
+// RGB332 picture (IMG_CODEC_RGB332), for the 8 bit mode: tokens as for
+// IMG_CODEC_PAL8, but the bytes are the colours themselves, without a
+// palette. In 8 bit mode they go out as they are, in 16 bit mode they are
+// widened to RGB565.
+void Display_DrawRGB332(const uint8_t *data, uint16_t length)
+{
+	const uint8_t *end = data + length;
+	uint8_t token, n;
+
+	SPI_begin();
+	while (data < end)
+	{
+		token = *data++;
+		if (token & 0x80)
+		{
+			Display_ImageRun(RGB332_TO_565(*data), (token & 0x7F) + 2);
+			data++;
+		}
+		else if (display_colours == DISPLAY_COLOURS_8 && !image_clip)
+			for (n = token + 1; n; n--)
+				SPIPut8Bit(*data++);
+		else
+			for (n = token + 1; n; n--, data++)
+				Display_ImagePut(RGB332_TO_565(*data));
+	}
+	SPI_end();
+}
+
+// Draw a picture table generated by tools/imgconv at (x, y).
+// length is the number of table entries, decoding ends there.
+// The picture is clipped to the screen.
+void Display_DrawImage(int16_t x, int16_t y, uint8_t w, uint8_t h, const void *data, uint16_t length, uint8_t codec)
+{
+	DisplayRect c;
+
+	if (!Display_Clip(x, y, w, h, &c))
+		return;
+	PROF_BEGIN(PROF_SEC_BLIT);
+	image_clip = (c.x2 - c.x1 != w || c.y2 - c.y1 != h);
+	if (image_clip)
+	{
+		image_w = w;
+		image_x1 = c.x1 - x;
+		image_x2 = c.x2 - x;
+		image_y1 = c.y1 - y;
+		image_y2 = c.y2 - y;
+		image_col = 0;
+		image_row = 0;
+	}
+	Display_SetWindow(c.x1, c.y1, c.x2 - c.x1, c.y2 - c.y1);
+	switch (codec)
+	{
+	case IMG_CODEC_RAW:
+		Display_DrawRaw(data, length);
+		break;
+	case IMG_CODEC_RLE:
+		Display_DrawRLE(data, length);
+		break;
+	case IMG_CODEC_PAL8:
+		Display_DrawPal8(data, length);
+		break;
+	case IMG_CODEC_PAL4:
+		Display_DrawPal4(data, length);
+		break;
+	case IMG_CODEC_RGB332:
+		Display_DrawRGB332(data, length);
+		break;
+	}
+	image_clip = 0;
+	PROF_END(PROF_SEC_BLIT);
+}
@@ -0,0 +1,98 @@
+#ifndef _DISPLAY_H_
+
+#define _DISPLAY_H_
+
+#include <stdint.h>
+#include "hal.h"
+
+#define DISPLAY_SHORT 132 // panel 132 x 176 pixels
+#define DISPLAY_LONG 176
+
+// orientations for Display_SetOrientation, clockwise
+#define DISPLAY_ROT_0 0	  // Hochformat 132 x 176
+#define DISPLAY_ROT_90 1  // Querformat 176 x 132
+#define DISPLAY_ROT_180 2 // Hochformat upside down
+#define DISPLAY_ROT_270 3 // Querformat upside down
+
+#ifndef DISPLAY_ORIENTATION // set by the project in s65config.h
+#define DISPLAY_ORIENTATION DISPLAY_ROT_0
+#endif
+
+// screen size in the current orientation
+#define DISPLAY_WIDTH display_width
+#define DISPLAY_HEIGHT display_height
+extern uint8_t display_width, display_height;
+
+// colour modes for Display_SetColours: 16 bit RGB565 (2 bytes per pixel) or
+// 8 bit RGB332 (1 byte per pixel). Colours are always given as RGB565, in
+// 8 bit mode the drawing functions send their upper bits.
+#define DISPLAY_COLOURS_16 16
+#define DISPLAY_COLOURS_8 8
+
+// The 8 bit mode is opt-in: its command words (display.c) are not confirmed
+// on a panel yet. Without DISPLAY_RGB332 the display stays in the 16 bit
+// mode of the original init and all 8 bit paths compile away.
+#ifndef DISPLAY_RGB332
+#define DISPLAY_RGB332 0
+#endif
+
+#ifndef DISPLAY_COLOURS
+#define DISPLAY_COLOURS DISPLAY_COLOURS_16 // mode after Display_init
+#endif
+
+#if DISPLAY_RGB332
+extern uint8_t display_colours;
+#else
+#if DISPLAY_COLOURS == DISPLAY_COLOURS_8
+#error "DISPLAY_COLOURS 8 needs DISPLAY_RGB332 1"
+#endif
+#define display_colours DISPLAY_COLOURS_16
+#endif
+
+#define RGB565_TO_332(c) ((((c) >> 8) & 0xE0) | (((c) >> 6) & 0x1C) | (((c) >> 3) & 0x03))
+// the bits are repeated, so white stays white
+#define RGB332_TO_565(b) ((((uint16_t)(b) & 0xE0) << 8) | (((uint16_t)(b) & 0xC0) << 5) | \
+						  (((uint16_t)(b) & 0x1C) << 6) | (((uint16_t)(b) & 0x1C) << 3) | \
+						  (((b) & 0x03) << 3) | (((b) & 0x03) << 1) | (((b) & 0x02) >> 1))
+
+// picture codecs, the ids are written by tools/imgconv into the tables
+#define IMG_CODEC_RAW 0 // one RGB565 word per pixel
+#define IMG_CODEC_RLE 1 // "repeat pair + count"
+#define IMG_CODEC_PAL8 2 // palette up to 256 colours, 8 bit indices, runs
+#define IMG_CODEC_PAL4 3 // palette up to 16 colours, run length + index per byte
+#define IMG_CODEC_RGB332 4 // RGB332 bytes with runs as IMG_CODEC_PAL8, no palette
+
+#define DISPLAY_INIT_DONE 0xFFFF // Display_initStep: init finished
+
+void SendCommandSeq(const uint16_t *data, uint8_t Anzahl);
+void Display_init(void);
+void Display_initStart(void);
+uint16_t Display_initStep(void);
+void Display_SetOrientation(uint8_t rot);
+uint8_t Display_GetOrientation(void);
+void Display_SetColours(uint8_t colours);
+void Display_WindowWords(uint16_t *window, uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+uint8_t Display_SetWindow(int16_t x, int16_t y, uint8_t w, uint8_t h);
+void Display_OpenWindow(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+void Display_FillRect(int16_t x, int16_t y, uint8_t w, uint8_t h, uint16_t colour);
+void Display_RepeatColour(uint16_t colour, uint16_t count);
+void Display_DrawRaw(const uint16_t *data, uint16_t length);
+void Display_DrawRLE(const uint16_t *data, uint16_t length);
+void Display_DrawPal8(const uint8_t *data, uint16_t length);
+void Display_DrawPal4(const uint8_t *data, uint16_t length);
+void Display_DrawRGB332(const uint8_t *data, uint16_t length);
+void Display_DrawImage(int16_t x, int16_t y, uint8_t w, uint8_t h, const void *data, uint16_t length, uint8_t codec);
+
+// one pixel inside an open transaction, in the current colour mode
+HAL_INLINE void Display_PutColour(uint16_t colour)
+{
+	if (display_colours == DISPLAY_COLOURS_8)
+		SPIPut8Bit(RGB565_TO_332(colour));
+	else
+	{
+		SPIPut8Bit(colour >> 8);
+		SPIPut8Bit(colour);
+	}
+}
+
+#endif
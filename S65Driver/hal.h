@@ -0,0 +1,132 @@
+#ifndef _HAL_H_
+
+#define _HAL_H_
+
+#include <stdint.h>
+#include "s65config.h" // of the project the library is built for
+
+// Hardware abstraction for the S65 display bus.
+// hal_avr.c drives SPI, D_C and Reset of the ATmega328P, the host build in
+// tools/s65host implements the same functions on a virtual display.
+// The calls made per byte or per transaction (SPIPut8Bit, SPI_begin,
+// SPI_end, HAL_SetDC, HAL_ReadFlash16) are always inlined on the AVR: a
+// call costs 8 cycles plus the registers it clobbers, as much as half a byte
+// on the bus, and with a constant argument HAL_SetDC folds to one sbi/cbi.
+
+void SPI_init(void);
+void SPISend8Bit(uint8_t data);
+void SPISend16Bit(uint16_t data);
+void SPIStream16Bit(const uint16_t *data, uint16_t Anzahl);
+void SPIRepeat16Bit(uint16_t data, uint16_t Anzahl);
+
+#ifdef __AVR__
+#include <xc.h>
+#include "prof.h"
+
+#define HAL_INLINE static inline __attribute__((always_inline))
+
+// display control pins, the same wiring in both projects
+#define HAL_CS PINB2	// PORTB: CS (SS of the SPI)
+#define HAL_DC PIND2	// PORTD: Data/Command
+#define HAL_RESET PIND3 // PORTD: Reset
+
+// Display transport, selected at build time (HAL_TRANSPORT_USART 1 in s65config.h):
+// 0: SPI (SPDR), SDA on MOSI PB3, CLK on SCK PB5
+// 1: USART0 in Master SPI mode, SDA on TXD0 PD1, CLK on XCK0 PD4.
+//    The transmitter is double buffered, the next byte is loaded while the
+//    current one shifts, so the bus runs without gaps between bytes.
+#ifndef HAL_TRANSPORT_USART
+#define HAL_TRANSPORT_USART 0
+#endif
+
+// SPI_WAIT: the next byte can be loaded, SPI_PUT: load it,
+// SPI_FLUSH: the last byte is out (before CS or D_C change)
+#if HAL_TRANSPORT_USART
+#define SPI_WAIT() while (!(UCSR0A & (1 << UDRE0)))
+// TXC0 is cleared with every byte, so it is only set once the bus is idle
+#define SPI_PUT(data)              \
+	do                             \
+	{                              \
+		UDR0 = (data);             \
+		UCSR0A = (1 << TXC0);      \
+	} while (0)
+#define SPI_FLUSH() while (!(UCSR0A & (1 << TXC0)))
+#else
+#define SPI_WAIT() while (!(SPSR & (1 << SPIF))) // wait for transmission complete
+#define SPI_PUT(data) SPDR = (data)
+#define SPI_FLUSH() SPI_WAIT()
+#endif
+
+// pipelined write inside an open transaction: waits for the previous byte
+// and returns while this one is shifting
+HAL_INLINE void SPIPut8Bit(uint8_t data)
+{
+	SPI_WAIT();
+	SPI_PUT(data);
+}
+
+// SPI transaction start: CS low, stays low until SPI_end()
+HAL_INLINE void SPI_begin(void)
+{
+	PORTB &= ~(1 << HAL_CS);
+}
+
+// SPI transaction end: waits for the last byte, then CS high
+HAL_INLINE void SPI_end(void)
+{
+	SPI_FLUSH();
+	PORTB |= (1 << HAL_CS);
+}
+
+// Data/Command line of the display, 1 = Kommando, 0 = Daten
+HAL_INLINE void HAL_SetDC(uint8_t level)
+{
+	SPI_FLUSH(); // the last byte must be out before D_C changes
+	if (level)
+		PORTD |= (1 << HAL_DC);
+	else
+		PORTD &= ~(1 << HAL_DC);
+}
+
+// Flash address for HAL_ReadFlash16. With -mconst-data-in-progmem a
+// const pointer is a 24 bit __memx pointer (bit 23 set: RAM), which does not
+// fit the 16 bit Z register. The 32 KB flash of the ATmega328P is addressed
+// by the low 16 bits, HAL_FLASH converts a const table pointer once before a
+// loop.
+typedef uint16_t HalFlash;
+#define HAL_FLASH(p) ((HalFlash)(__uint24)(p))
+
+// sequential read of a const table in flash: "lpm Z+" fetches both bytes
+// and leaves Z on the next word, so a decoder walking a table never reloads
+// the address
+HAL_INLINE uint16_t HAL_ReadFlash16(HalFlash *p)
+{
+	uint16_t data;
+	HalFlash addr = *p;
+	__asm__ volatile("lpm %A0, Z+\n\tlpm %B0, Z+" : "=r"(data), "+z"(addr));
+	*p = addr;
+	return data;
+}
+#else
+#define HAL_INLINE static inline
+
+void SPIPut8Bit(uint8_t data);
+void SPI_begin(void);
+void SPI_end(void);
+void HAL_SetDC(uint8_t level); // 1 = Kommando, 0 = Daten
+
+typedef const uint16_t *HalFlash;
+#define HAL_FLASH(p) (p)
+
+HAL_INLINE uint16_t HAL_ReadFlash16(HalFlash *p)
+{
+	return *(*p)++;
+}
+#endif
+
+void HAL_SetReset(uint8_t level); // 0 = display in reset
+
+void init_Timer1(void);
+void Waitms(const uint32_t msWait);
+
+#endif
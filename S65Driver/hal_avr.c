@@ -0,0 +1,113 @@
+#define F_CPU 16000000UL
+#include <xc.h>
+#include "hal.h"
+
+// AVR backend of hal.h: display bus (SPI or USART0 in Master SPI mode, see
+// HAL_TRANSPORT_USART in hal.h) and display control pins.
+// SPI_begin, SPI_end and HAL_SetDC are inline in hal.h, init_Timer1 and
+// Waitms are in timer.c.
+// With PROFILE the streams inside a transaction count no bytes, the display
+// driver counts them once per command sequence and window (display.c).
+
+#define SPI_DDR DDRB
+#define MOSI PINB3
+#define SCK PINB5
+#define XCK PIND4 // USART0 clock in Master SPI mode
+
+// SPI initialization
+void SPI_init(void)
+{
+	DDRD |= (1 << HAL_DC) | (1 << HAL_RESET); // output: PD2 -> Data/Command; PD3 -> Reset
+#if HAL_TRANSPORT_USART
+	SPI_DDR |= (1 << HAL_CS); // CS output
+	PORTB |= (1 << HAL_CS);	  // CS high
+	UBRR0 = 0;
+	DDRD |= (1 << XCK);	   // XCK0 output => USART is the clock master
+	UCSR0C = (1 << UMSEL01) | (1 << UMSEL00); // Master SPI, MSB first, SPI mode 0
+	UCSR0B = (1 << TXEN0); // transmitter only, TXD0 (PD1) is SDA
+	UBRR0 = 0;			   // fosc/2 => 8MHz, set after TXEN0 (data sheet)
+#else
+	// set CS, MOSI and SCK to output
+	SPI_DDR |= (1 << HAL_CS) | (1 << MOSI) | (1 << SCK);
+	PORTB |= (1 << HAL_CS); // CS high
+	// enable SPI, set as master, and clock to fosc/2 (SPI2X) => 8MHz
+	SPCR = (1 << SPE) | (1 << MSTR);
+	SPSR |= (1 << SPI2X);
+#endif
+	// All writes below wait until the next byte can be loaded and do not wait
+	// afterwards, so the caller can prepare the next byte while the last one
+	// is shifting. A dummy byte with CS high sets SPIF (TXC0) for the first
+	// write and the first SPI_FLUSH.
+	SPI_PUT(0);
+}
+
+// SPI send 8 bit (single byte transaction)
+void SPISend8Bit(uint8_t data)
+{
+	PROF_SPI_BYTES(1);
+	SPI_begin();
+	SPIPut8Bit(data);
+	SPI_end();
+}
+
+// SPI send 16 bit (one transaction, CS stays low for both bytes)
+void SPISend16Bit(uint16_t data)
+{
+	PROF_SPI_BYTES(2);
+	SPI_begin();
+	SPIPut8Bit((data >> 8) & 0xFF); // High-Byte
+	SPIPut8Bit(data & 0xFF);		// Low-Byte
+	SPI_end();
+}
+
+// SPI stream of Anzahl 16 bit words inside an open transaction.
+// The next word is fetched while the low byte is still shifting out.
+void SPIStream16Bit(const uint16_t *data, uint16_t Anzahl)
+{
+	uint16_t word;
+	while (Anzahl--)
+	{
+		word = *data++;
+		SPI_WAIT();
+		SPI_PUT((word >> 8) & 0xFF); // High-Byte
+		SPI_WAIT();
+		SPI_PUT(word & 0xFF); // Low-Byte
+	}
+}
+
+// SPI stream of the same 16 bit word Anzahl times inside an open transaction
+// (solid colour fills). High and low byte are split only once, the loop is
+// unrolled to two words so the counter only runs every 4 bytes.
+void SPIRepeat16Bit(uint16_t data, uint16_t Anzahl)
+{
+	uint8_t high = (data >> 8) & 0xFF;
+	uint8_t low = data & 0xFF;
+	if (Anzahl & 1) // odd count: one single word before the unrolled loop
+	{
+		SPI_WAIT();
+		SPI_PUT(high);
+		SPI_WAIT();
+		SPI_PUT(low);
+	}
+	Anzahl >>= 1;
+	while (Anzahl--)
+	{
+		SPI_WAIT();
+		SPI_PUT(high);
+		SPI_WAIT();
+		SPI_PUT(low);
+		SPI_WAIT();
+		SPI_PUT(high);
+		SPI_WAIT();
+		SPI_PUT(low);
+	}
+}
+
+// Reset line of the display
+void HAL_SetReset(uint8_t level)
+{
+	if (level)
+		PORTD |= (1 << HAL_RESET);
+	else
+		PORTD &= ~(1 << HAL_RESET);
+}
@@ -0,0 +1,124 @@
+#define F_CPU 16000000UL
+#include <xc.h>
+#include <avr/interrupt.h>
+#include "hal.h"
+#include "timer.h"
+#include "prof.h"
+
+// Profiling counters and their export over USART0 (see prof.h).
+// Prof_task runs in the main loop. It copies the counters into the frame
+// buffer with interrupts disabled, and the data register empty interrupt
+// sends the frame while the firmware goes on.
+
+#if PROFILE
+
+#if HAL_TRANSPORT_USART
+#error "PROFILE needs USART0, the display transport HAL_TRANSPORT_USART uses it already"
+#endif
+
+#define PROF_UBRR (F_CPU / 8 / PROF_BAUD - 1) // U2X0: 115200 baud +2.1%
+
+typedef struct
+{
+	uint16_t count;
+	uint32_t total; // ticks
+	uint32_t max;	// ticks
+} ProfSection;
+
+static ProfSection sections[PROF_SECTIONS];
+static uint32_t start[PROF_SECTIONS]; // Timer_ticks at PROF_BEGIN
+static uint16_t latency_max;
+static uint32_t last_frame; // ms
+uint32_t prof_spi_bytes;
+
+static uint8_t frame[PROF_FRAME_SIZE];
+static volatile uint8_t tx_pos;
+
+ISR(USART_UDRE_vect)
+{
+	UDR0 = frame[tx_pos++];
+	if (tx_pos == PROF_FRAME_SIZE)
+		UCSR0B &= ~(1 << UDRIE0);
+}
+
+void Prof_init(void)
+{
+	UBRR0 = PROF_UBRR;
+	UCSR0A = (1 << U2X0);
+	UCSR0C = (1 << UCSZ01) | (1 << UCSZ00); // 8N1
+	UCSR0B = (1 << TXEN0);
+}
+
+void Prof_begin(uint8_t section)
+{
+	start[section] = Timer_ticks();
+}
+
+void Prof_end(uint8_t section)
+{
+	uint32_t ticks = Timer_ticks() - start[section];
+	ProfSection *s = &sections[section];
+	s->count++;
+	s->total += ticks;
+	if (ticks > s->max)
+		s->max = ticks;
+}
+
+// Called at the start of an interrupt with the ticks since its event
+void Prof_latency(uint16_t ticks)
+{
+	if (ticks > latency_max)
+		latency_max = ticks;
+}
+
+static uint8_t *put16(uint8_t *p, uint16_t v)
+{
+	*p++ = v;
+	*p++ = v >> 8;
+	return p;
+}
+
+static uint8_t *put32(uint8_t *p, uint32_t v)
+{
+	p = put16(p, v);
+	return put16(p, v >> 16);
+}
+
+// Send a frame every PROF_PERIOD_MS. A frame still being sent is not
+// overwritten, the next one just comes later.
+void Prof_task(void)
+{
+	uint32_t now = Timer_now();
+	uint8_t *p = frame;
+	uint8_t i, sum = 0;
+
+	if ((int32_t)(now - last_frame) < PROF_PERIOD_MS || (UCSR0B & (1 << UDRIE0)))
+		return;
+	last_frame = now;
+
+	*p++ = 0xA5;
+	*p++ = 0x5A;
+	*p++ = PROF_VERSION;
+	*p++ = PROF_SECTIONS;
+	*p++ = 1000 / TIMER_TICKS_PER_MS;
+	p = put32(p, now);
+	cli(); // the interrupts update their counters
+	p = put32(p, prof_spi_bytes);
+	p = put16(p, latency_max);
+	p = put32(p, Timer_sleepTicks());
+	for (i = 0; i < PROF_SECTIONS; i++)
+	{
+		p = put16(p, sections[i].count);
+		p = put32(p, sections[i].total);
+		p = put32(p, sections[i].max);
+	}
+	sei();
+	for (i = 2; i < PROF_FRAME_SIZE - 1; i++)
+		sum += frame[i];
+	*p = sum;
+
+	tx_pos = 0;
+	UCSR0B |= (1 << UDRIE0);
+}
+
+#endif
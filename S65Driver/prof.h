@@ -0,0 +1,67 @@
+#ifndef _PROF_H_
+
+#define _PROF_H_
+
+#include <stdint.h>
+#include "s65config.h"
+
+// On-target profiling, built with PROFILE 1 in s65config.h of the project.
+// Sections are timed with the Timer1 time base (Timer_ticks, 4 us per tick).
+// Per section the number of runs, the summed and the longest duration are
+// kept, besides the bytes sent to the display and the worst interrupt
+// latency. Prof_task sends a snapshot over USART0 every PROF_PERIOD_MS,
+// tools/profdump decodes it.
+// Without PROFILE all macros are empty and prof.c compiles to nothing.
+
+#ifndef PROFILE
+#define PROFILE 0
+#endif
+
+// sections
+#define PROF_SEC_INIT 0 // Display_init
+#define PROF_SEC_FILL 1 // Display_FillRect
+#define PROF_SEC_BLIT 2 // Display_DrawImage
+#define PROF_SEC_ISR 3	// body of the Timer1 interrupts
+#define PROF_SEC_WAIT 4 // Waitms
+#define PROF_SECTIONS 5
+
+#define PROF_PERIOD_MS 1000 // one frame per second
+#define PROF_BAUD 115200	// 8N1, TXD0 on PD1
+
+// Frame, all values little endian:
+//  0  0xA5 0x5A          sync
+//  2  u8  version        PROF_VERSION
+//  3  u8  sections       PROF_SECTIONS
+//  4  u8  tick_us        length of one tick in us
+//  5  u32 uptime         ms since init_Timer1
+//  9  u32 spi_bytes      bytes sent to the display (counted per window)
+// 13  u16 latency_max    worst interrupt latency in ticks
+// 15  u32 sleep_ticks    time Waitms spent in idle sleep (Timer_sleepTicks)
+// 19  per section: u16 count, u32 total ticks, u32 max ticks
+//  .  u8  checksum       sum of all bytes from offset 2
+// The counters run from reset on and wrap around (count after 65536 runs,
+// total after 4.7 hours of section time).
+#define PROF_VERSION 2
+#define PROF_FRAME_SIZE (19 + 10 * PROF_SECTIONS + 1)
+
+#if PROFILE
+extern uint32_t prof_spi_bytes;
+
+void Prof_init(void);
+void Prof_begin(uint8_t section);
+void Prof_end(uint8_t section);
+void Prof_latency(uint16_t ticks);
+void Prof_task(void);
+
+#define PROF_BEGIN(section) Prof_begin(section)
+#define PROF_END(section) Prof_end(section)
+#define PROF_LATENCY(ticks) Prof_latency(ticks)
+#define PROF_SPI_BYTES(n) (prof_spi_bytes += (n))
+#else
+#define PROF_BEGIN(section)
+#define PROF_END(section)
+#define PROF_LATENCY(ticks)
+#define PROF_SPI_BYTES(n)
+#endif
+
+#endif
@@ -0,0 +1,262 @@
+#include <xc.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include "hal.h"
+#include "timer.h"
+#include "prof.h"
+
+// Tickless timer service on Timer1.
+// Timer1 runs free at fosc/64 (4 us per tick). The overflow interrupt
+// (every 262.144 ms) carries the 32 bit millisecond clock, the compare
+// interrupt is only armed for the next deadline (software timer or Waitms),
+// so there is no interrupt every millisecond any more.
+// Deadlines are absolute milliseconds and compared with signed differences,
+// so durations up to 2^31 ms (24 days) work across the wraparound.
+
+#define TIMER_OVF_MS 262	// one overflow = 65536 ticks = 262 ms + 36 ticks
+#define TIMER_OVF_FRAC 36
+
+typedef struct
+{
+	TimerCallback callback;
+	uint32_t deadline; // absolute ms
+	uint32_t period;   // 0 = one-shot
+} SoftTimer;
+
+static SoftTimer timers[TIMER_MAX]; // callback == 0: free
+static volatile uint32_t timer_ms;	// clock at the last overflow
+static volatile uint8_t timer_frac; // ticks beyond timer_ms at the last overflow
+static volatile uint16_t timer_ovf; // overflows, upper half of Timer_ticks
+static uint32_t wait_deadline;		// deadline of a running Waitms
+static uint8_t waiting;
+
+static uint32_t timer_sleep_ticks; // time spent in idle sleep, Timer_sleepTicks
+
+static void Timer_service(void);
+
+ISR(TIMER1_OVF_vect)
+{
+	timer_ovf++; // before PROF_BEGIN, TOV1 is already cleared here
+	PROF_BEGIN(PROF_SEC_ISR);
+	timer_ms += TIMER_OVF_MS;
+	timer_frac += TIMER_OVF_FRAC;
+	if (timer_frac >= TIMER_TICKS_PER_MS)
+	{
+		timer_frac -= TIMER_TICKS_PER_MS;
+		timer_ms++;
+	}
+	Timer_service(); // deadlines more than one overflow away are armed here
+	PROF_END(PROF_SEC_ISR);
+}
+
+ISR(TIMER1_COMPA_vect)
+{
+	PROF_LATENCY(TCNT1 - OCR1A);
+	PROF_BEGIN(PROF_SEC_ISR);
+	Timer_service();
+	PROF_END(PROF_SEC_ISR);
+}
+
+// Timer1 as free running time base
+void init_Timer1(void)
+{
+	TCCR1A = 0;
+	TCCR1B = (1 << CS11) | (1 << CS10); // normal mode, prescaler 64
+	TIMSK1 = (1 << TOIE1);				// compare interrupt is armed per deadline
+}
+
+// Clock in ms and the ticks already elapsed of the current ms.
+// Must be called with interrupts disabled.
+static uint32_t Timer_read(uint8_t *phase)
+{
+	uint16_t t = TCNT1;
+	uint32_t ms = timer_ms;
+	uint8_t frac = timer_frac;
+	uint16_t q, r;
+
+	if ((TIFR1 & (1 << TOV1)) && t < 0x8000) // overflow not yet counted
+	{
+		ms += TIMER_OVF_MS;
+		frac += TIMER_OVF_FRAC;
+		if (frac >= TIMER_TICKS_PER_MS)
+		{
+			frac -= TIMER_TICKS_PER_MS;
+			ms++;
+		}
+	}
+	q = t / TIMER_TICKS_PER_MS;
+	r = t - q * TIMER_TICKS_PER_MS + frac;
+	if (r >= TIMER_TICKS_PER_MS)
+	{
+		r -= TIMER_TICKS_PER_MS;
+		q++;
+	}
+	*phase = r;
+	return ms + q;
+}
+
+// 32 bit monotonic clock in ms since init_Timer1, read atomically
+uint32_t Timer_now(void)
+{
+	uint8_t sreg = SREG;
+	uint8_t phase;
+	uint32_t now;
+	cli();
+	now = Timer_read(&phase);
+	SREG = sreg;
+	return now;
+}
+
+// 32 bit tick counter (4 us per tick, wraps after 4.7 hours) for time
+// measurements, cheaper than Timer_now
+uint32_t Timer_ticks(void)
+{
+	uint8_t sreg = SREG;
+	uint16_t t, ovf;
+	cli();
+	t = TCNT1;
+	ovf = timer_ovf;
+	if ((TIFR1 & (1 << TOV1)) && t < 0x8000) // overflow not yet counted
+		ovf++;
+	SREG = sreg;
+	return ((uint32_t)ovf << 16) | t;
+}
+
+// Time Waitms has spent in idle sleep since the start (4 us ticks, wraps
+// after 4.7 hours), the CPU time the timer service leaves free. Reported in
+// the profiling frames.
+uint32_t Timer_sleepTicks(void)
+{
+	uint8_t sreg = SREG;
+	uint32_t ticks;
+	cli();
+	ticks = timer_sleep_ticks;
+	SREG = sreg;
+	return ticks;
+}
+
+// Arm the compare interrupt for the earliest deadline. Deadlines more than
+// 260 ms away are left to the overflow interrupt, which calls this again.
+// Must be called with interrupts disabled.
+static void Timer_arm(void)
+{
+	uint8_t phase, i;
+	uint32_t now = Timer_read(&phase);
+	int32_t next = 261, left;
+	uint16_t ticks;
+
+	if (waiting && (int32_t)(wait_deadline - now) > 0) // a passed one has woken Waitms already
+		next = (int32_t)(wait_deadline - now);
+	for (i = 0; i < TIMER_MAX; i++)
+	{
+		if (!timers[i].callback)
+			continue;
+		left = (int32_t)(timers[i].deadline - now);
+		if (left < next)
+			next = left;
+	}
+	if (next > 260)
+	{
+		TIMSK1 &= ~(1 << OCIE1A);
+		return;
+	}
+	if (next <= 0)
+		ticks = 2; // already due: interrupt right away
+	else
+		ticks = (uint16_t)next * TIMER_TICKS_PER_MS - phase;
+	if (ticks < 2) // TCNT1 must not pass OCR1A before it is written
+		ticks = 2;
+	OCR1A = TCNT1 + ticks;
+	TIFR1 = (1 << OCF1A);
+	TIMSK1 |= (1 << OCIE1A);
+}
+
+// Run the due software timers and arm the next deadline (interrupt context)
+static void Timer_service(void)
+{
+	uint8_t phase, i;
+	uint32_t now = Timer_read(&phase);
+	TimerCallback callback;
+
+	for (i = 0; i < TIMER_MAX; i++)
+	{
+		callback = timers[i].callback;
+		if (!callback || (int32_t)(now - timers[i].deadline) < 0)
+			continue;
+		if (timers[i].period)
+			timers[i].deadline += timers[i].period;
+		else
+			timers[i].callback = 0;
+		callback();
+	}
+	Timer_arm();
+}
+
+// Start a software timer: callback runs after delay_ms and then every
+// period_ms (0 = once). Callbacks run in the Timer1 interrupt and must be
+// short. Returns a handle for Timer_stop, 0 if all timers are in use.
+uint8_t Timer_start(TimerCallback callback, uint32_t delay_ms, uint32_t period_ms)
+{
+	uint8_t sreg = SREG;
+	uint8_t i;
+
+	cli();
+	for (i = 0; i < TIMER_MAX && timers[i].callback; i++)
+		;
+	if (i == TIMER_MAX)
+	{
+		SREG = sreg;
+		return 0;
+	}
+	timers[i].deadline = Timer_now() + delay_ms;
+	timers[i].period = period_ms;
+	timers[i].callback = callback;
+	Timer_arm();
+	SREG = sreg;
+	return i + 1;
+}
+
+void Timer_stop(uint8_t handle)
+{
+	uint8_t sreg = SREG;
+	if (handle == 0 || handle > TIMER_MAX)
+		return;
+	cli();
+	timers[handle - 1].callback = 0;
+	Timer_arm();
+	SREG = sreg;
+}
+
+// wait for msWait milliseconds function
+// The core sleeps in idle mode (SPI, timers and the other interrupts keep
+// running) until the compare interrupt of the deadline wakes it up. Other
+// interrupts wake it earlier, then it goes back to sleep.
+// timer_sleep_ticks adds up the time spent asleep. The interrupt state of
+// the caller is restored at the end.
+void Waitms(const uint32_t msWait)
+{
+	uint8_t sreg = SREG;
+	uint32_t deadline;
+	uint16_t t0;
+
+	PROF_BEGIN(PROF_SEC_WAIT);
+	cli();
+	deadline = Timer_now() + msWait;
+	wait_deadline = deadline;
+	waiting = 1;
+	Timer_arm();
+	set_sleep_mode(SLEEP_MODE_IDLE);
+	while ((int32_t)(Timer_now() - deadline) < 0)
+	{
+		t0 = TCNT1;
+		sleep_enable();
+		sei(); // the instruction after sei runs before any interrupt
+		sleep_cpu();
+		sleep_disable();
+		cli();
+		timer_sleep_ticks += (uint16_t)(TCNT1 - t0); // under 65536 ticks, the overflow wakes up
+	}
+	waiting = 0;
+	SREG = sreg;
+	PROF_END(PROF_SEC_WAIT);
+}
@@ -0,0 +1,18 @@
+#ifndef _TIMER_H_
+
+#define _TIMER_H_
+
+#include <stdint.h>
+
+#define TIMER_MAX 4			  // number of software timers
+#define TIMER_TICKS_PER_MS 250 // Timer1 at fosc/64 => 4 us per tick
+
+typedef void (*TimerCallback)(void);
+
+uint32_t Timer_now(void);
+uint32_t Timer_ticks(void);
+uint32_t Timer_sleepTicks(void);
+uint8_t Timer_start(TimerCallback callback, uint32_t delay_ms, uint32_t period_ms);
+void Timer_stop(uint8_t handle);
+
+#endif
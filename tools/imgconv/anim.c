@@ -0,0 +1,241 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "imgconv.h"
+
+// imgconv -a: animation tables for Projekt_Versuch4.X/anim.c (layout in
+// its anim.h). The first picture becomes the keyframe, every step after it
+// only holds the rectangles in which the picture changed, each one with
+// the smallest codec. The last step leads from the last picture back to the
+// first one.
+
+#define ANIM_MAX_RECTS 32 // per step, more changes go out as one bounding rectangle
+// unchanged columns between two changes that are sent along: resending a
+// pixel costs CYC_RLE_PIXEL at most, a new window CYC_CALL
+#define RECT_GAP (CYC_CALL / CYC_RLE_PIXEL)
+
+typedef struct
+{
+	int x, y, w, h;
+} Rect;
+
+typedef struct
+{
+	Rect r;
+	int codec;
+	Buf b;
+} Part;
+
+// a and b differ in row y between the columns x0 and x1 - 1
+static int row_changed(const Image *a, const Image *b, int y, int x0, int x1)
+{
+	for (int x = x0; x < x1; x++)
+		if (a->px[y * a->w + x] != b->px[y * a->w + x])
+			return 1;
+	return 0;
+}
+
+static int col_changed(const Image *a, const Image *b, int x, int y0, int y1)
+{
+	for (int y = y0; y < y1; y++)
+		if (a->px[y * a->w + x] != b->px[y * a->w + x])
+			return 1;
+	return 0;
+}
+
+// Rectangles over the pixels in which a and b differ: bands of changed
+// rows, in every band the runs of changed columns (gaps up to RECT_GAP are
+// closed), each run cut down to its own changed rows. Returns the number.
+static int diff_rects(const Image *a, const Image *b, Rect *r)
+{
+	int n = 0, y0, y1, x0, x1, x, t, e;
+	Rect box = {a->w, a->h, 0, 0}; // bounding box, x1/y1 in w/h
+
+	for (y0 = 0; y0 < a->h; y0 = y1)
+	{
+		if (!row_changed(a, b, y0, 0, a->w))
+		{
+			y1 = y0 + 1;
+			continue;
+		}
+		for (y1 = y0 + 1; y1 < a->h && row_changed(a, b, y1, 0, a->w); y1++)
+			;
+		for (x0 = 0; x0 < a->w; x0 = x1)
+		{
+			x1 = x0 + 1;
+			if (!col_changed(a, b, x0, y0, y1))
+				continue;
+			for (x = x1; x < a->w && x - x1 <= RECT_GAP; x++)
+				if (col_changed(a, b, x, y0, y1))
+					x1 = x + 1;
+			for (t = y0; !row_changed(a, b, t, x0, x1); t++)
+				;
+			for (e = y1; !row_changed(a, b, e - 1, x0, x1); e--)
+				;
+			if (n < ANIM_MAX_RECTS)
+				r[n] = (Rect){x0, t, x1 - x0, e - t};
+			n++;
+			if (x0 < box.x)
+				box.x = x0;
+			if (t < box.y)
+				box.y = t;
+			if (x1 > box.w)
+				box.w = x1;
+			if (e > box.h)
+				box.h = e;
+		}
+	}
+	if (n > ANIM_MAX_RECTS)
+	{
+		r[0] = (Rect){box.x, box.y, box.w - box.x, box.h - box.y};
+		n = 1;
+	}
+	return n;
+}
+
+static void crop(const Image *img, const Rect *r, Image *out)
+{
+	out->w = r->w;
+	out->h = r->h;
+	out->px = malloc(sizeof(uint16_t) * r->w * r->h);
+	for (int y = 0; y < r->h; y++)
+		memcpy(out->px + y * r->w, img->px + (r->y + y) * img->w + r->x, sizeof(uint16_t) * r->w);
+}
+
+static int write_files(const char *base, const char *name, char *const *inputs, int n, int period,
+					   const Image *pic, const Part *parts, int nparts, const int *steps, long bytes)
+{
+	char path[1024], guard[256], macro[256];
+	const char *file = strrchr(base, '/') ? strrchr(base, '/') + 1 : base;
+	const char *first = strrchr(inputs[0], '/') ? strrchr(inputs[0], '/') + 1 : inputs[0];
+	const char *last = strrchr(inputs[n - 1], '/') ? strrchr(inputs[n - 1], '/') + 1 : inputs[n - 1];
+	FILE *f;
+	int s, k, p;
+
+	upper(macro, name);
+	upper(guard, file);
+
+	snprintf(path, sizeof(path), "%s.h", base);
+	if (!(f = fopen(path, "w")))
+		return -1;
+	fprintf(f, "/* generated by tools/imgconv from %s .. %s - do not edit */\n", first, last);
+	fprintf(f, "#ifndef _%s_H_\n\n#define _%s_H_\n\n#include \"anim.h\"\n\n", guard, guard);
+	fprintf(f, "#define %s_WIDTH %d\n", macro, pic->w);
+	fprintf(f, "#define %s_HEIGHT %d\n", macro, pic->h);
+	fprintf(f, "#define %s_FRAMES %d\n", macro, n);
+	fprintf(f, "#define %s_PERIOD_MS %d\n\n", macro, period);
+	fprintf(f, "extern const Anim %s;\n\n#endif\n", name);
+	fclose(f);
+
+	snprintf(path, sizeof(path), "%s.c", base);
+	if (!(f = fopen(path, "w")))
+		return -1;
+	fprintf(f, "/* generated by tools/imgconv from %s .. %s - do not edit\n", first, last);
+	fprintf(f, "   %s: %d x %d Pixel, %d pictures every %d ms, %ld bytes */\n\n", name, pic->w, pic->h, n, period, bytes);
+	fprintf(f, "#include \"%s.h\"\n", file);
+	for (s = 0, p = 0; s <= n; s++)
+		for (k = 0; k < steps[s]; k++, p++)
+		{
+			fprintf(f, "\nstatic const %s %s_%d_%d[%zu] = {\n", parts[p].b.bytewise ? "unsigned char" : "unsigned short",
+					name, s, k, parts[p].b.n);
+			write_values(f, &parts[p].b);
+		}
+	fprintf(f, "\nstatic const AnimRect %s_rects[%d] = {\n", name, nparts);
+	for (s = 0, p = 0; s <= n; s++)
+		for (k = 0; k < steps[s]; k++, p++)
+			fprintf(f, "\t{%d, %d, %d, %d, %s, %zu, %s_%d_%d},\n", parts[p].r.x, parts[p].r.y, parts[p].r.w, parts[p].r.h,
+					codecs[parts[p].codec].macro, parts[p].b.n, name, s, k);
+	fprintf(f, "};\n\nstatic const unsigned char %s_steps[%d] = {", name, n + 1);
+	for (s = 0; s <= n; s++)
+		fprintf(f, s ? ", %d" : "%d", steps[s]);
+	fprintf(f, "};\n\nconst Anim %s = {%d, %d, %d, %d, %s_rects, %s_steps};\n", name, pic->w, pic->h, n, period, name, name);
+	fclose(f);
+	return 0;
+}
+
+// Convert n pictures into an animation with one picture every period ms
+int write_anim(const char *base, const char *name, char *const *inputs, int n, int period, const char *force, int reduce8)
+{
+	Image *pic = calloc(n, sizeof(Image));
+	Part *parts = malloc(sizeof(Part) * (n + 1) * ANIM_MAX_RECTS);
+	int *steps = calloc(n + 1, sizeof(int));
+	int nparts = 0, s, k, m;
+	long keyframe = 0, deltas = 0, single = 0;
+
+	for (s = 0; s < n; s++)
+	{
+		if (read_image(inputs[s], &pic[s]) != 0)
+		{
+			fprintf(stderr, "imgconv: cannot read %s\n", inputs[s]);
+			return 1;
+		}
+		if (pic[s].w != pic[0].w || pic[s].h != pic[0].h || pic[s].w > 255 || pic[s].h > 255)
+		{
+			fprintf(stderr, "imgconv: %s: all pictures must have the same size, up to 255 x 255\n", inputs[s]);
+			return 1;
+		}
+		if (reduce8)
+			reduce_rgb332(&pic[s]);
+	}
+	printf("%s .. %s: %d pictures of %d x %d, one every %d ms\n", inputs[0], inputs[n - 1], n, pic[0].w, pic[0].h, period);
+	printf("step\trects\tpixels\tbytes\tdecode_ms\n");
+
+	// step 0: keyframe, step s: picture s - 1 -> s, step n: last -> first
+	for (s = 0; s <= n; s++)
+	{
+		Rect r[ANIM_MAX_RECTS];
+		long bytes = 0, cyc = 0, pixels = 0;
+
+		if (s == 0)
+		{
+			r[0] = (Rect){0, 0, pic[0].w, pic[0].h};
+			m = 1;
+		}
+		else
+			m = diff_rects(&pic[s - 1], &pic[s % n], r);
+		for (k = 0; k < m; k++, nparts++)
+		{
+			Part *p = &parts[nparts];
+			Image sub;
+			crop(&pic[s % n], &r[k], &sub);
+			p->r = r[k];
+			memset(&p->b, 0, sizeof(Buf));
+			p->codec = encode_best(&sub, force, &p->b);
+			if (p->codec < 0 || p->b.n > 0xFFFF)
+			{
+				fprintf(stderr, "imgconv: step %d: no usable codec '%s'\n", s, force);
+				return 1;
+			}
+			bytes += buf_bytes(&p->b);
+			cyc += codecs[p->codec].cycles(&sub, &p->b);
+			pixels += (long)sub.w * sub.h;
+			free(sub.px);
+		}
+		steps[s] = m;
+		printf("%d\t%d\t%ld\t%ld\t%.1f%s\n", s, m, pixels, bytes, cyc / 16000.0,
+			   s && cyc / 16000.0 > period ? "\tlonger than a frame, frames will drop" : "");
+		if (s)
+			deltas += bytes;
+		else
+			keyframe = bytes;
+	}
+
+	for (s = 0; s < n; s++) // the same pictures one by one, for comparison
+	{
+		Buf b;
+		memset(&b, 0, sizeof(Buf));
+		if (encode_best(&pic[s], "auto", &b) >= 0)
+			single += buf_bytes(&b);
+		free(b.v);
+	}
+	printf("keyframe %ld bytes + steps %ld bytes = %ld bytes, as single pictures %ld bytes\n",
+		   keyframe, deltas, keyframe + deltas, single);
+
+	if (write_files(base, name, inputs, n, period, &pic[0], parts, nparts, steps, keyframe + deltas) != 0)
+	{
+		perror(base);
+		return 1;
+	}
+	printf("wrote %s.c/.h\n", base);
+	return 0;
+}
@@ -0,0 +1,726 @@
+// imgconv: converts a PNG or PPM picture into a PROGMEM table for the S65
+// display code. Every codec is tried, the smallest one is written as a
+// .c/.h pair with width, height, length and codec id, and the compression
+// ratio and an estimated decode time on the ATmega328P are printed.
+//
+// usage: imgconv [-n name] [-c auto|raw|rle|pal8|pal4|rgb332] [-q colours] [-8] [-o outbase] [-s file.s65] input.png|input.ppm
+//        imgconv -a ms [-n name] [-c auto|raw|rle|pal8|pal4|rgb332] [-8] [-o outbase] picture0 picture1...
+//        imgconv -k rrggbb [-n name] [-8] [-o outbase] input.png|input.ppm
+//   -n  C name of the table (default: input file name without extension)
+//   -c  force a codec (default auto = smallest)
+//   -q  reduce the picture to this many colours first (lossy, for pal8/pal4)
+//   -8  reduce the picture to RGB332 first (lossy, for the 8 bit colour mode
+//       of the display, codec rgb332)
+//   -o  output path without extension (default: name)
+//   -s  also write the table as a stream frame for tools/imgstream
+//       (Versuch4 built with -DSTREAM=1, frame layout in stream.h)
+//   -a  animation of all pictures, one every ms milliseconds, as a keyframe
+//       and the changed rectangles of every step (anim.c, Versuch4/anim.h)
+//   -k  sprite with the colour rrggbb (hex) as transparent key, as rows of
+//       opaque spans (keysprite.c, Versuch4/keysprite.h)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <png.h>
+
+#include "imgconv.h"
+
+// ---------------------------------------------------------------- input
+
+static int read_ppm(const char *path, Image *img)
+{
+	FILE *f = fopen(path, "rb");
+	int max, c;
+	if (!f)
+		return -1;
+	if (fscanf(f, "P6 %d %d %d", &img->w, &img->h, &max) != 3 || max != 255)
+	{
+		fclose(f);
+		return -1;
+	}
+	fgetc(f);
+	img->px = malloc(sizeof(uint16_t) * img->w * img->h);
+	for (int k = 0; k < img->w * img->h; k++)
+	{
+		unsigned char rgb[3];
+		if (fread(rgb, 1, 3, f) != 3)
+		{
+			fclose(f);
+			return -1;
+		}
+		img->px[k] = rgb565(rgb[0], rgb[1], rgb[2]);
+	}
+	c = fclose(f);
+	return c;
+}
+
+static int read_png(const char *path, Image *img)
+{
+	png_image pi;
+	unsigned char *buf;
+	memset(&pi, 0, sizeof(pi));
+	pi.version = PNG_IMAGE_VERSION;
+	if (!png_image_begin_read_from_file(&pi, path))
+		return -1;
+	pi.format = PNG_FORMAT_RGB;
+	buf = malloc(PNG_IMAGE_SIZE(pi));
+	if (!png_image_finish_read(&pi, NULL, buf, 0, NULL))
+	{
+		free(buf);
+		return -1;
+	}
+	img->w = pi.width;
+	img->h = pi.height;
+	img->px = malloc(sizeof(uint16_t) * img->w * img->h);
+	for (int k = 0; k < img->w * img->h; k++)
+		img->px[k] = rgb565(buf[3 * k], buf[3 * k + 1], buf[3 * k + 2]);
+	free(buf);
+	return 0;
+}
+
+int read_image(const char *path, Image *img)
+{
+	const char *dot = strrchr(path, '.');
+	if (dot && strcasecmp(dot, ".png") == 0)
+		return read_png(path, img);
+	return read_ppm(path, img);
+}
+
+uint16_t rgb565(unsigned r, unsigned g, unsigned b)
+{
+	// rounding so that RGB565 -> RGB888 -> RGB565 is lossless
+	return (((r * 31 + 127) / 255) << 11) | (((g * 63 + 127) / 255) << 5) | ((b * 31 + 127) / 255);
+}
+
+void rgb888(uint16_t c, unsigned *r, unsigned *g, unsigned *b)
+{
+	*r = ((c >> 11) & 0x1F) * 255 / 31;
+	*g = ((c >> 5) & 0x3F) * 255 / 63;
+	*b = (c & 0x1F) * 255 / 31;
+}
+
+// the upper bits, as RGB565_TO_332 of the firmware
+uint8_t rgb332(uint16_t c)
+{
+	return ((c >> 8) & 0xE0) | ((c >> 6) & 0x1C) | ((c >> 3) & 0x03);
+}
+
+// widened with repeated bits, as RGB332_TO_565 of the firmware
+uint16_t rgb332_565(uint8_t b)
+{
+	return ((b & 0xE0) << 8) | ((b & 0xC0) << 5) | ((b & 0x1C) << 6) | ((b & 0x1C) << 3) |
+		   ((b & 0x03) << 3) | ((b & 0x03) << 1) | ((b & 0x02) >> 1);
+}
+
+// ---------------------------------------------------------------- buffers
+
+void buf_put(Buf *b, uint16_t v)
+{
+	if (b->n == b->cap)
+	{
+		b->cap = b->cap ? 2 * b->cap : 1024;
+		b->v = realloc(b->v, sizeof(uint16_t) * b->cap);
+	}
+	b->v[b->n++] = v;
+}
+
+size_t buf_bytes(const Buf *b)
+{
+	return b->n * (b->bytewise ? 1 : 2);
+}
+
+// ---------------------------------------------------------------- codecs
+
+// codec 0: one RGB565 word per pixel
+static void raw_encode(const Image *img, Buf *out)
+{
+	for (int k = 0; k < img->w * img->h; k++)
+		buf_put(out, img->px[k]);
+}
+
+static long raw_decode(const Buf *in, uint16_t *px, long max)
+{
+	long n = 0;
+	for (size_t k = 0; k < in->n && n < max; k++)
+		px[n++] = in->v[k];
+	return n;
+}
+
+static long raw_cycles(const Image *img, const Buf *in)
+{
+	(void)in;
+	return (long)img->w * img->h * CYC_STREAM_PIXEL + CYC_CALL;
+}
+
+// codec 1: "repeat pair + count" as in the original Bild1 table:
+// w, w, n => n + 2 pixels of w; any other word is a single pixel.
+// Runs stop at 0xFFFF pixels so n + 2 still fits the decoder's 16 bit count.
+static void rle_encode(const Image *img, Buf *out)
+{
+	int total = img->w * img->h;
+	int k = 0;
+	while (k < total)
+	{
+		int run = 1;
+		while (k + run < total && img->px[k + run] == img->px[k] && run < 0xFFFF)
+			run++;
+		if (run >= 2)
+		{
+			buf_put(out, img->px[k]);
+			buf_put(out, img->px[k]);
+			buf_put(out, run - 2);
+		}
+		else
+			buf_put(out, img->px[k]);
+		k += run;
+	}
+}
+
+static long rle_decode(const Buf *in, uint16_t *px, long max)
+{
+	long n = 0;
+	size_t k = 0;
+	while (k < in->n)
+	{
+		if (k + 2 < in->n && in->v[k] == in->v[k + 1])
+		{
+			long run = in->v[k + 2] + 2;
+			while (run-- && n < max)
+				px[n++] = in->v[k];
+			k += 3;
+		}
+		else
+		{
+			if (n < max)
+				px[n++] = in->v[k];
+			k++;
+		}
+	}
+	return n;
+}
+
+static long rle_cycles(const Image *img, const Buf *in)
+{
+	long runs = 0, singles = 0;
+	size_t k = 0;
+	while (k < in->n)
+	{
+		if (k + 2 < in->n && in->v[k] == in->v[k + 1])
+		{
+			runs++;
+			k += 3;
+		}
+		else
+		{
+			singles++;
+			k++;
+		}
+	}
+	return (long)img->w * img->h * CYC_RLE_PIXEL + runs * CYC_RLE_RUN + singles * CYC_RLE_SINGLE + CYC_CALL;
+}
+
+// palette of an image, most frequent colour first; returns the number of
+// colours or -1 if there are more than max
+static int palette(const Image *img, uint16_t *pal, int max, uint8_t *index)
+{
+	static long count[65536];
+	int n = 0;
+	memset(count, 0, sizeof(count));
+	for (int k = 0; k < img->w * img->h; k++)
+		count[img->px[k]]++;
+	for (int c = 0; c < 65536; c++)
+		if (count[c])
+		{
+			if (n == max)
+				return -1;
+			pal[n++] = c;
+		}
+	for (int a = 1; a < n; a++) // insertion sort by frequency
+	{
+		uint16_t c = pal[a];
+		int b = a;
+		while (b > 0 && count[pal[b - 1]] < count[c])
+		{
+			pal[b] = pal[b - 1];
+			b--;
+		}
+		pal[b] = c;
+	}
+	for (int k = 0; k < img->w * img->h; k++)
+		for (int c = 0; c < n; c++)
+			if (pal[c] == img->px[k])
+			{
+				index[k] = c;
+				break;
+			}
+	return n;
+}
+
+static void put_palette(Buf *out, const uint16_t *pal, int n)
+{
+	buf_put(out, n - 1);
+	for (int c = 0; c < n; c++) // pre-split for the SPI stream
+	{
+		buf_put(out, pal[c] >> 8);
+		buf_put(out, pal[c] & 0xFF);
+	}
+}
+
+// run length tokens of pal8 and rgb332: b < 0x80 => b + 1 literal bytes,
+// b >= 0x80 => (b & 0x7F) + 2 pixels of the following byte
+static void put_runs(Buf *out, const uint8_t *idx, int total)
+{
+	int k = 0;
+	while (k < total)
+	{
+		int run = 1;
+		while (k + run < total && idx[k + run] == idx[k] && run < 129)
+			run++;
+		if (run >= 2)
+		{
+			buf_put(out, 0x80 | (run - 2));
+			buf_put(out, idx[k]);
+			k += run;
+			continue;
+		}
+		// literals up to the next run of two
+		int lit = 1;
+		while (k + lit < total && lit < 128 && !(k + lit + 1 < total && idx[k + lit] == idx[k + lit + 1]))
+			lit++;
+		buf_put(out, lit - 1);
+		while (lit--)
+			buf_put(out, idx[k++]);
+	}
+}
+
+// codec 2: up to 256 colours, 8 bit indices with run length tokens:
+// [n-1] [palette hi,lo]*n, then the tokens of put_runs
+static void pal8_encode(const Image *img, Buf *out)
+{
+	uint16_t pal[256];
+	int total = img->w * img->h;
+	uint8_t *idx = malloc(total);
+	int n = palette(img, pal, 256, idx);
+
+	out->bytewise = 1;
+	if (n >= 0)
+	{
+		put_palette(out, pal, n);
+		put_runs(out, idx, total);
+	}
+	free(idx);
+}
+
+static long pal8_decode(const Buf *in, uint16_t *px, long max)
+{
+	int n = in->v[0] + 1;
+	size_t k = 1 + 2 * n;
+	long m = 0;
+	while (k < in->n)
+	{
+		uint16_t t = in->v[k++];
+		int cnt = (t & 0x80) ? (t & 0x7F) + 2 : t + 1;
+		while (cnt-- && k < in->n)
+		{
+			uint16_t i = in->v[k];
+			if (i >= n || m >= max)
+				return -1;
+			px[m++] = (in->v[1 + 2 * i] << 8) | in->v[2 + 2 * i];
+			if (!(t & 0x80))
+				k++;
+		}
+		if (t & 0x80)
+			k++;
+	}
+	return m;
+}
+
+static long pal8_cycles(const Image *img, const Buf *in)
+{
+	long cyc = CYC_CALL;
+	size_t k = 1 + 2 * (in->v[0] + 1);
+	(void)img;
+	while (k < in->n)
+	{
+		uint16_t t = in->v[k++];
+		if (t & 0x80)
+		{
+			cyc += CYC_PAL_RUN + ((t & 0x7F) + 2) * CYC_STREAM_PIXEL;
+			k++;
+		}
+		else
+		{
+			cyc += CYC_PAL_LITERAL + (t + 1) * CYC_PAL_PIXEL;
+			k += t + 1;
+		}
+	}
+	return cyc;
+}
+
+// codec 3: up to 16 colours, one byte per run: (length - 1) << 4 | index
+static void pal4_encode(const Image *img, Buf *out)
+{
+	uint16_t pal[16];
+	int total = img->w * img->h;
+	uint8_t *idx = malloc(total);
+	int n = palette(img, pal, 16, idx);
+	int k = 0;
+
+	out->bytewise = 1;
+	if (n < 0)
+	{
+		free(idx);
+		return;
+	}
+	put_palette(out, pal, n);
+	while (k < total)
+	{
+		int run = 1;
+		while (k + run < total && idx[k + run] == idx[k] && run < 16)
+			run++;
+		buf_put(out, ((run - 1) << 4) | idx[k]);
+		k += run;
+	}
+	free(idx);
+}
+
+static long pal4_decode(const Buf *in, uint16_t *px, long max)
+{
+	int n = in->v[0] + 1;
+	long m = 0;
+	for (size_t k = 1 + 2 * n; k < in->n; k++)
+	{
+		int i = in->v[k] & 0x0F, cnt = (in->v[k] >> 4) + 1;
+		if (i >= n)
+			return -1;
+		while (cnt-- && m < max)
+			px[m++] = (in->v[1 + 2 * i] << 8) | in->v[2 + 2 * i];
+	}
+	return m;
+}
+
+static long pal4_cycles(const Image *img, const Buf *in)
+{
+	long cyc = CYC_CALL;
+	(void)img;
+	for (size_t k = 1 + 2 * (in->v[0] + 1); k < in->n; k++)
+	{
+		int cnt = (in->v[k] >> 4) + 1;
+		cyc += (cnt == 1) ? CYC_PAL_PIXEL : CYC_PAL_RUN + cnt * CYC_STREAM_PIXEL;
+	}
+	return cyc;
+}
+
+// codec 4: the RGB332 colours themselves with the tokens of put_runs, no
+// palette. Only for pictures that are RGB332 already (-8).
+static void rgb332_encode(const Image *img, Buf *out)
+{
+	int total = img->w * img->h;
+	uint8_t *c = malloc(total);
+
+	out->bytewise = 1;
+	for (int k = 0; k < total; k++)
+	{
+		c[k] = rgb332(img->px[k]);
+		if (rgb332_565(c[k]) != img->px[k])
+		{
+			free(c);
+			return;
+		}
+	}
+	put_runs(out, c, total);
+	free(c);
+}
+
+static long rgb332_decode(const Buf *in, uint16_t *px, long max)
+{
+	long m = 0;
+	size_t k = 0;
+	while (k < in->n)
+	{
+		uint16_t t = in->v[k++];
+		int cnt = (t & 0x80) ? (t & 0x7F) + 2 : t + 1;
+		while (cnt-- && k < in->n)
+		{
+			if (m >= max)
+				return -1;
+			px[m++] = rgb332_565(in->v[k]);
+			if (!(t & 0x80))
+				k++;
+		}
+		if (t & 0x80)
+			k++;
+	}
+	return m;
+}
+
+static long rgb332_cycles(const Image *img, const Buf *in)
+{
+	long cyc = CYC_CALL;
+	size_t k = 0;
+	(void)img;
+	while (k < in->n)
+	{
+		uint16_t t = in->v[k++];
+		if (t & 0x80)
+		{
+			cyc += CYC_PAL_RUN + ((t & 0x7F) + 2) * CYC_BYTE_PIXEL;
+			k++;
+		}
+		else
+		{
+			cyc += CYC_PAL_LITERAL + (t + 1) * CYC_RGB332_PIXEL;
+			k += t + 1;
+		}
+	}
+	return cyc;
+}
+
+const Codec codecs[NCODECS] = {
+	{CODEC_RAW, "raw", "IMG_CODEC_RAW", raw_encode, raw_decode, raw_cycles},
+	{CODEC_RLE, "rle", "IMG_CODEC_RLE", rle_encode, rle_decode, rle_cycles},
+	{CODEC_PAL8, "pal8", "IMG_CODEC_PAL8", pal8_encode, pal8_decode, pal8_cycles},
+	{CODEC_PAL4, "pal4", "IMG_CODEC_PAL4", pal4_encode, pal4_decode, pal4_cycles},
+	{CODEC_RGB332, "rgb332", "IMG_CODEC_RGB332", rgb332_encode, rgb332_decode, rgb332_cycles},
+};
+
+// Encode img with every codec that can hold it and keep the smallest one
+// (or the one named force) in out. Returns its index in codecs, -1 if none.
+int encode_best(const Image *img, const char *force, Buf *out)
+{
+	long pixels = (long)img->w * img->h;
+	uint16_t *check = malloc(sizeof(uint16_t) * pixels);
+	int best = -1;
+	Buf b;
+
+	for (int k = 0; k < NCODECS; k++)
+	{
+		memset(&b, 0, sizeof(Buf));
+		codecs[k].encode(img, &b);
+		if (b.n > 0 && codecs[k].decode(&b, check, pixels) == pixels &&
+			memcmp(check, img->px, sizeof(uint16_t) * pixels) == 0 &&
+			(strcmp(force, "auto") == 0 ? (best < 0 || buf_bytes(&b) < buf_bytes(out))
+										: strcmp(force, codecs[k].name) == 0))
+		{
+			free(out->v);
+			*out = b;
+			best = k;
+		}
+		else
+			free(b.v);
+	}
+	free(check);
+	return best;
+}
+
+// ---------------------------------------------------------------- output
+
+void upper(char *dst, const char *src)
+{
+	while (*src)
+		*dst++ = toupper((unsigned char)*src++);
+	*dst = 0;
+}
+
+// table body, 16 entries per line
+void write_values(FILE *f, const Buf *b)
+{
+	for (size_t k = 0; k < b->n; k++)
+	{
+		fprintf(f, b->bytewise ? "0x%02X," : "0x%04X,", b->v[k]);
+		fputc((k % 16 == 15 || k + 1 == b->n) ? '\n' : ' ', f);
+	}
+	fprintf(f, "};\n");
+}
+
+static int write_tables(const char *base, const char *name, const char *src, const Image *img,
+						const Codec *c, const Buf *b)
+{
+	char path[1024], guard[256], macro[256];
+	const char *type = b->bytewise ? "unsigned char" : "unsigned short";
+	const char *file = strrchr(base, '/') ? strrchr(base, '/') + 1 : base;
+	FILE *f;
+
+	if (strrchr(src, '/'))
+		src = strrchr(src, '/') + 1;
+
+	upper(macro, name);
+	upper(guard, file);
+
+	snprintf(path, sizeof(path), "%s.h", base);
+	if (!(f = fopen(path, "w")))
+		return -1;
+	fprintf(f, "/* generated by tools/imgconv from %s - do not edit */\n", src);
+	fprintf(f, "#ifndef _%s_H_\n\n#define _%s_H_\n\n", guard, guard);
+	fprintf(f, "#define %s_WIDTH %d\n", macro, img->w);
+	fprintf(f, "#define %s_HEIGHT %d\n", macro, img->h);
+	fprintf(f, "#define %s_LENGTH %zu\n", macro, b->n);
+	fprintf(f, "#define %s_CODEC %d /* %s */\n\n", macro, c->id, c->macro);
+	fprintf(f, "extern const %s %s[%s_LENGTH];\n\n#endif\n", type, name, macro);
+	fclose(f);
+
+	snprintf(path, sizeof(path), "%s.c", base);
+	if (!(f = fopen(path, "w")))
+		return -1;
+	fprintf(f, "/* generated by tools/imgconv from %s - do not edit\n", src);
+	fprintf(f, "   %s: %d x %d Pixel, codec %s, %zu bytes */\n\n", name, img->w, img->h, c->name, buf_bytes(b));
+	fprintf(f, "#include \"%s.h\"\n\n", file);
+	fprintf(f, "const %s %s[%s_LENGTH] = {\n", type, name, macro);
+	write_values(f, b);
+	fclose(f);
+	return 0;
+}
+
+// stream frame: 'S' '6' codec x y w h length, then the table; x and y are
+// 0xFF (centred), tools/imgstream can set them
+static int write_stream(const char *path, const Image *img, const Codec *c, const Buf *b)
+{
+	FILE *f = fopen(path, "wb");
+	if (!f)
+		return -1;
+	fprintf(f, "S6");
+	fputc(c->id, f);
+	fputc(0xFF, f);
+	fputc(0xFF, f);
+	fputc(img->w, f);
+	fputc(img->h, f);
+	fputc(b->n & 0xFF, f);
+	fputc(b->n >> 8, f);
+	for (size_t k = 0; k < b->n; k++)
+	{
+		if (!b->bytewise)
+			fputc(b->v[k] >> 8, f); // high byte first, the order on the bus
+		fputc(b->v[k] & 0xFF, f);
+	}
+	return fclose(f);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *name = NULL, *base = NULL, *input = NULL, *force = "auto", *stream = NULL;
+	char *inputs[ANIM_MAX_FRAMES];
+	int colours = 0, period = 0, ninputs = 0, reduce8 = 0;
+	long key = -1; // -k: RGB888 colour key
+	char defname[256];
+	Image img;
+	Buf bufs[NCODECS];
+	int best = -1;
+
+	for (int k = 1; k < argc; k++)
+	{
+		if (strcmp(argv[k], "-n") == 0 && k + 1 < argc)
+			name = argv[++k];
+		else if (strcmp(argv[k], "-o") == 0 && k + 1 < argc)
+			base = argv[++k];
+		else if (strcmp(argv[k], "-c") == 0 && k + 1 < argc)
+			force = argv[++k];
+		else if (strcmp(argv[k], "-q") == 0 && k + 1 < argc)
+			colours = atoi(argv[++k]);
+		else if (strcmp(argv[k], "-s") == 0 && k + 1 < argc)
+			stream = argv[++k];
+		else if (strcmp(argv[k], "-8") == 0)
+			reduce8 = 1;
+		else if (strcmp(argv[k], "-a") == 0 && k + 1 < argc)
+			period = atoi(argv[++k]);
+		else if (strcmp(argv[k], "-k") == 0 && k + 1 < argc)
+			key = strtol(argv[++k], NULL, 16) & 0xFFFFFF;
+		else if (argv[k][0] != '-' && ninputs < ANIM_MAX_FRAMES)
+			inputs[ninputs++] = argv[k];
+		else
+		{
+			fprintf(stderr, "usage: imgconv [-n name] [-c auto|raw|rle|pal8|pal4|rgb332] [-q colours] [-8] [-o outbase] [-s file.s65] input.png|input.ppm\n"
+							"       imgconv -a ms [-n name] [-c auto|raw|rle|pal8|pal4|rgb332] [-8] [-o outbase] picture0 picture1...\n"
+							"       imgconv -k rrggbb [-n name] [-8] [-o outbase] input.png|input.ppm\n");
+			return 2;
+		}
+	}
+	if (!ninputs)
+	{
+		fprintf(stderr, "imgconv: no input file\n");
+		return 2;
+	}
+	if (period ? (ninputs < 2 || period > 0xFFFF || colours || stream) : ninputs > 1)
+	{
+		fprintf(stderr, "imgconv: -a needs 2 or more pictures, 1..65535 ms and no -q or -s\n");
+		return 2;
+	}
+	input = inputs[0];
+	if (read_image(input, &img) != 0)
+	{
+		fprintf(stderr, "imgconv: cannot read %s\n", input);
+		return 1;
+	}
+	if (!name)
+	{
+		const char *s = strrchr(input, '/') ? strrchr(input, '/') + 1 : input;
+		snprintf(defname, sizeof(defname), "%s", s);
+		if (strchr(defname, '.'))
+			*strchr(defname, '.') = 0;
+		name = defname;
+	}
+	if (!base)
+		base = name;
+	if (key >= 0 && (period || colours || stream))
+	{
+		fprintf(stderr, "imgconv: -k goes without -a, -q and -s\n");
+		return 2;
+	}
+	if (key >= 0)
+		return write_keysprite(base, name, input, &img, rgb565(key >> 16, (key >> 8) & 0xFF, key & 0xFF), reduce8);
+	if (period)
+		return write_anim(base, name, inputs, ninputs, period, force, reduce8);
+
+	long pixels = (long)img.w * img.h;
+	uint16_t *check = malloc(sizeof(uint16_t) * pixels);
+	printf("%s: %d x %d, raw %ld bytes\n", input, img.w, img.h, pixels * 2);
+	if (colours > 0)
+	{
+		double psnr;
+		int used = quantize(&img, colours, &psnr);
+		printf("reduced to %d colours, PSNR %.1f dB\n", used, psnr);
+	}
+	if (reduce8)
+		printf("reduced to RGB332, PSNR %.1f dB\n", reduce_rgb332(&img));
+	printf("codec\tbytes\tratio\tdecode_cycles\tdecode_ms\n");
+	for (int k = 0; k < NCODECS; k++)
+	{
+		memset(&bufs[k], 0, sizeof(Buf));
+		codecs[k].encode(&img, &bufs[k]);
+		if (bufs[k].n == 0 || codecs[k].decode(&bufs[k], check, pixels) != pixels ||
+			memcmp(check, img.px, sizeof(uint16_t) * pixels) != 0)
+		{
+			printf("%s\t-\t-\t-\t-\n", codecs[k].name); // not usable for this image
+			continue;
+		}
+		long cyc = codecs[k].cycles(&img, &bufs[k]);
+		printf("%s\t%zu\t%.2f\t%ld\t%.1f\n", codecs[k].name, buf_bytes(&bufs[k]),
+			   (double)pixels * 2 / buf_bytes(&bufs[k]), cyc, cyc / 16000.0);
+		if (strcmp(force, "auto") == 0 ? (best < 0 || buf_bytes(&bufs[k]) < buf_bytes(&bufs[best]))
+									   : strcmp(force, codecs[k].name) == 0)
+			best = k;
+	}
+	if (best < 0)
+	{
+		fprintf(stderr, "imgconv: no usable codec '%s'\n", force);
+		return 1;
+	}
+	if (write_tables(base, name, input, &img, &codecs[best], &bufs[best]) != 0)
+	{
+		perror(base);
+		return 1;
+	}
+	printf("wrote %s.c/.h with codec %s\n", base, codecs[best].name);
+	if (stream)
+	{
+		if (img.w > 255 || img.h > 255 || bufs[best].n > 0xFFFF || write_stream(stream, &img, &codecs[best], &bufs[best]) != 0)
+		{
+			fprintf(stderr, "imgconv: cannot write stream frame %s\n", stream);
+			return 1;
+		}
+		printf("wrote %s (%zu bytes)\n", stream, buf_bytes(&bufs[best]) + 9);
+	}
+	return 0;
+}
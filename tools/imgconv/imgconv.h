@@ -0,0 +1,71 @@
+#ifndef _IMGCONV_H_
+
+#define _IMGCONV_H_
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// codec ids, same numbers as IMG_CODEC_* in the firmware display.h
+#define CODEC_RAW 0
+#define CODEC_RLE 1
+#define CODEC_PAL8 2
+#define CODEC_PAL4 3
+#define CODEC_RGB332 4
+
+// decode cost model for the ATmega328P at 16 MHz (cycles), used for the
+// estimate printed next to the size
+#define CYC_CALL 300		 // window, call and transaction setup
+#define CYC_STREAM_PIXEL 36	 // streamed RGB565 pixel (2 bytes at fosc/2)
+#define CYC_RLE_PIXEL 36	 // pixel inside one transaction, bound by the bus
+#define CYC_RLE_RUN 45		 // run token: count read, SPIRepeat16Bit call
+#define CYC_RLE_SINGLE 4	 // single token: lpm Z+ read and compare not hidden by the bus
+#define CYC_PAL_PIXEL 40	 // literal palette pixel: index + 2 palette reads, 2 SPIPut8Bit
+#define CYC_PAL_RUN 45		 // run token: 2 reads, palette lookup, SPIRepeat16Bit call
+#define CYC_PAL_LITERAL 15	 // literal token header
+#define CYC_BYTE_PIXEL 18	 // rgb332 in 8 bit mode: one byte per pixel
+#define CYC_RGB332_PIXEL 20	 // literal rgb332 pixel: byte read, SPIPut8Bit
+typedef struct
+{
+	int w, h;
+	uint16_t *px; // RGB565, row by row
+} Image;
+
+typedef struct
+{
+	uint16_t *v;
+	size_t n, cap;
+	int bytewise; // table is emitted as unsigned char
+} Buf;
+
+typedef struct
+{
+	int id;
+	const char *name;
+	const char *macro;
+	void (*encode)(const Image *img, Buf *out);
+	long (*decode)(const Buf *in, uint16_t *px, long max);
+	long (*cycles)(const Image *img, const Buf *in);
+} Codec;
+
+#define ANIM_MAX_FRAMES 64 // pictures of one animation (imgconv -a)
+
+#define NCODECS 5
+extern const Codec codecs[NCODECS];
+
+uint16_t rgb565(unsigned r, unsigned g, unsigned b);
+void rgb888(uint16_t c, unsigned *r, unsigned *g, unsigned *b);
+uint8_t rgb332(uint16_t c);
+uint16_t rgb332_565(uint8_t b);
+int quantize(Image *img, int colours, double *psnr);
+double reduce_rgb332(Image *img);
+int read_image(const char *path, Image *img);
+void buf_put(Buf *b, uint16_t v);
+size_t buf_bytes(const Buf *b);
+int encode_best(const Image *img, const char *force, Buf *out);
+void upper(char *dst, const char *src);
+void write_values(FILE *f, const Buf *b);
+int write_keysprite(const char *base, const char *name, const char *src, Image *img, uint16_t key, int reduce8);
+int write_anim(const char *base, const char *name, char *const *inputs, int n, int period_ms, const char *force, int reduce8);
+
+#endif
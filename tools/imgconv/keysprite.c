@@ -0,0 +1,125 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "imgconv.h"
+
+// imgconv -k: colour key sprite for Projekt_Versuch4.X/keysprite.c (layout
+// in its keysprite.h). Every row becomes a list of opaque spans, the pixels
+// of the key colour are dropped. The estimate counts one window per span,
+// rows with one span at the same place as the row above share it, as in
+// the firmware.
+
+static int write_files(const char *base, const char *name, const char *src, const Image *img,
+					   const Buf *rows, const Buf *spans, const Buf *pixels)
+{
+	char path[1024], guard[256], macro[256];
+	const char *file = strrchr(base, '/') ? strrchr(base, '/') + 1 : base;
+	FILE *f;
+
+	if (strrchr(src, '/'))
+		src = strrchr(src, '/') + 1;
+	upper(macro, name);
+	upper(guard, file);
+
+	snprintf(path, sizeof(path), "%s.h", base);
+	if (!(f = fopen(path, "w")))
+		return -1;
+	fprintf(f, "/* generated by tools/imgconv from %s - do not edit */\n", src);
+	fprintf(f, "#ifndef _%s_H_\n\n#define _%s_H_\n\n#include \"keysprite.h\"\n\n", guard, guard);
+	fprintf(f, "#define %s_WIDTH %d\n", macro, img->w);
+	fprintf(f, "#define %s_HEIGHT %d\n\n", macro, img->h);
+	fprintf(f, "extern const KeySprite %s;\n\n#endif\n", name);
+	fclose(f);
+
+	snprintf(path, sizeof(path), "%s.c", base);
+	if (!(f = fopen(path, "w")))
+		return -1;
+	fprintf(f, "/* generated by tools/imgconv from %s - do not edit\n", src);
+	fprintf(f, "   %s: %d x %d Pixel, %zu spans, %zu opaque pixels, %zu bytes */\n\n", name, img->w, img->h,
+			spans->n / 2, pixels->n, buf_bytes(rows) + buf_bytes(spans) + buf_bytes(pixels));
+	fprintf(f, "#include \"%s.h\"\n", file);
+	fprintf(f, "\nstatic const unsigned short %s_rows[%zu] = {\n", name, rows->n);
+	write_values(f, rows);
+	fprintf(f, "\nstatic const unsigned char %s_spans[%zu] = {\n", name, spans->n);
+	write_values(f, spans);
+	fprintf(f, "\nstatic const unsigned short %s_pixels[%zu] = {\n", name, pixels->n);
+	write_values(f, pixels);
+	fprintf(f, "\nconst KeySprite %s = {%d, %d, %s_rows, %s_spans, %s_pixels};\n", name, img->w, img->h, name, name, name);
+	fclose(f);
+	return 0;
+}
+
+// Convert img into a sprite, pixels of the colour key (RGB565, compared
+// before -8 reduces the picture) are transparent
+int write_keysprite(const char *base, const char *name, const char *src, Image *img, uint16_t key, int reduce8)
+{
+	Buf rows, spans, pixels;
+	unsigned char *opaque;
+	long windows = 0, cyc;
+	int x, y, x0, k;
+
+	if (img->w > 255 || img->h > 255)
+	{
+		fprintf(stderr, "imgconv: %s: a sprite can be up to 255 x 255\n", src);
+		return 1;
+	}
+	opaque = malloc(img->w * img->h);
+	for (x = 0; x < img->w * img->h; x++)
+		opaque[x] = img->px[x] != key;
+	if (reduce8)
+		printf("reduced to RGB332, PSNR %.1f dB\n", reduce_rgb332(img));
+
+	memset(&rows, 0, sizeof(Buf));
+	memset(&spans, 0, sizeof(Buf));
+	memset(&pixels, 0, sizeof(Buf));
+	spans.bytewise = 1;
+	for (y = 0; y < img->h; y++)
+	{
+		const unsigned char *o = opaque + y * img->w;
+		buf_put(&rows, spans.n / 2);
+		for (x = 0; x < img->w;)
+		{
+			if (!o[x])
+			{
+				x++;
+				continue;
+			}
+			for (x0 = x; x < img->w && o[x]; x++)
+				buf_put(&pixels, img->px[y * img->w + x]);
+			buf_put(&spans, x0);
+			buf_put(&spans, x - x0);
+		}
+	}
+	buf_put(&rows, spans.n / 2);
+	free(opaque);
+
+	// windows as KeySprite_blocks opens them
+	for (y = 0; y < img->h; y = k)
+	{
+		uint16_t i = rows.v[y];
+		k = y + 1;
+		if (rows.v[k] - i == 1)
+		{
+			while (k < img->h && rows.v[k + 1] - rows.v[k] == 1 && spans.v[2 * rows.v[k]] == spans.v[2 * i] &&
+				   spans.v[2 * rows.v[k] + 1] == spans.v[2 * i + 1])
+				k++;
+			windows++;
+		}
+		else
+			windows += rows.v[k] - i;
+	}
+	cyc = windows * CYC_CALL + (long)pixels.n * CYC_STREAM_PIXEL;
+
+	printf("%s: %d x %d, %zu opaque pixels of %d, %zu spans\n", src, img->w, img->h, pixels.n, img->w * img->h, spans.n / 2);
+	printf("sprite %zu bytes, %ld windows, estimated draw %.2f ms (whole rectangle raw %.2f ms)\n",
+		   buf_bytes(&rows) + buf_bytes(&spans) + buf_bytes(&pixels), windows, cyc / 16000.0,
+		   (CYC_CALL + (long)img->w * img->h * CYC_STREAM_PIXEL) / 16000.0);
+
+	if (write_files(base, name, src, img, &rows, &spans, &pixels) != 0)
+	{
+		perror(base);
+		return 1;
+	}
+	printf("wrote %s.c/.h\n", base);
+	return 0;
+}
@@ -0,0 +1,174 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "imgconv.h"
+
+// Median cut colour reduction for the palette codecs. The box with the
+// widest channel range is split at the weighted median until there are
+// enough boxes, each box becomes the weighted mean colour, and every pixel
+// is mapped to the nearest palette entry.
+
+typedef struct
+{
+	unsigned char rgb[3];
+	long count;
+} Entry;
+
+typedef struct
+{
+	int first, n; // range in the entry list
+} Box;
+
+static int sort_axis;
+
+static int by_axis(const void *a, const void *b)
+{
+	return ((const Entry *)a)->rgb[sort_axis] - ((const Entry *)b)->rgb[sort_axis];
+}
+
+static int widest(const Entry *e, const Box *b, int *range)
+{
+	int lo[3] = {255, 255, 255}, hi[3] = {0, 0, 0}, axis = 0;
+	for (int k = b->first; k < b->first + b->n; k++)
+		for (int c = 0; c < 3; c++)
+		{
+			if (e[k].rgb[c] < lo[c])
+				lo[c] = e[k].rgb[c];
+			if (e[k].rgb[c] > hi[c])
+				hi[c] = e[k].rgb[c];
+		}
+	for (int c = 1; c < 3; c++)
+		if (hi[c] - lo[c] > hi[axis] - lo[axis])
+			axis = c;
+	*range = hi[axis] - lo[axis];
+	return axis;
+}
+
+// reduce img to at most colours colours, returns the number of colours used
+int quantize(Image *img, int colours, double *psnr)
+{
+	static long count[65536];
+	int total = img->w * img->h, n = 0, boxes = 1;
+	Entry *e;
+	Box *box = calloc(colours, sizeof(Box));
+	uint16_t *pal = calloc(colours, sizeof(uint16_t));
+	double err = 0;
+
+	memset(count, 0, sizeof(count));
+	for (int k = 0; k < total; k++)
+		count[img->px[k]]++;
+	e = calloc(65536, sizeof(Entry));
+	for (int c = 0; c < 65536; c++)
+		if (count[c])
+		{
+			unsigned r, g, b;
+			rgb888(c, &r, &g, &b);
+			e[n].rgb[0] = r;
+			e[n].rgb[1] = g;
+			e[n].rgb[2] = b;
+			e[n].count = count[c];
+			n++;
+		}
+
+	box[0].first = 0;
+	box[0].n = n;
+	while (boxes < colours)
+	{
+		int pick = -1, best = 0, range;
+		for (int k = 0; k < boxes; k++)
+			if (box[k].n > 1 && (widest(e, &box[k], &range), range > best))
+			{
+				best = range;
+				pick = k;
+			}
+		if (pick < 0)
+			break;
+		sort_axis = widest(e, &box[pick], &range);
+		qsort(e + box[pick].first, box[pick].n, sizeof(Entry), by_axis);
+		long half = 0, sum = 0;
+		for (int k = box[pick].first; k < box[pick].first + box[pick].n; k++)
+			half += e[k].count;
+		int cut = box[pick].first; // becomes the first entry of the upper half
+		while ((sum += e[cut].count) < half / 2)
+			cut++;
+		cut++;
+		if (cut >= box[pick].first + box[pick].n) // both halves keep one entry
+			cut = box[pick].first + box[pick].n - 1;
+		box[boxes].first = cut;
+		box[boxes].n = box[pick].first + box[pick].n - cut;
+		box[pick].n = cut - box[pick].first;
+		boxes++;
+	}
+
+	for (int k = 0; k < boxes; k++)
+	{
+		double s[3] = {0, 0, 0};
+		long w = 0;
+		for (int j = box[k].first; j < box[k].first + box[k].n; j++)
+		{
+			for (int c = 0; c < 3; c++)
+				s[c] += (double)e[j].rgb[c] * e[j].count;
+			w += e[j].count;
+		}
+		pal[k] = rgb565(s[0] / w + 0.5, s[1] / w + 0.5, s[2] / w + 0.5);
+	}
+
+	for (int k = 0; k < total; k++)
+	{
+		unsigned r, g, b, pr, pg, pb;
+		long best = -1;
+		int pick = 0;
+		rgb888(img->px[k], &r, &g, &b);
+		for (int c = 0; c < boxes; c++)
+		{
+			rgb888(pal[c], &pr, &pg, &pb);
+			int dr = (int)r - (int)pr, dg = (int)g - (int)pg, db = (int)b - (int)pb;
+			long d = dr * dr + dg * dg + db * db;
+			if (best < 0 || d < best)
+			{
+				best = d;
+				pick = c;
+			}
+		}
+		img->px[k] = pal[pick];
+		err += best;
+	}
+	*psnr = err > 0 ? 10 * log10(255.0 * 255.0 * 3 * total / err) : 99.0;
+	free(e);
+	free(box);
+	free(pal);
+	return boxes;
+}
+
+// Map every pixel to the nearest colour of the 8 bit mode (RGB332 widened as
+// the display does it, rgb332_565). The channels are independent, so the
+// nearest level is picked per channel. Returns the PSNR.
+double reduce_rgb332(Image *img)
+{
+	double err = 0;
+	int total = img->w * img->h;
+
+	for (int k = 0; k < total; k++)
+	{
+		unsigned rgb[3], lvl[3], best[3] = {0, 0, 0};
+		long d[3] = {-1, -1, -1};
+		rgb888(img->px[k], &rgb[0], &rgb[1], &rgb[2]);
+		for (int b = 0; b < 256; b++) // every level of every channel occurs
+		{
+			static const uint8_t mask[3] = {0xE0, 0x1C, 0x03};
+			rgb888(rgb332_565(b), &lvl[0], &lvl[1], &lvl[2]);
+			for (int c = 0; c < 3; c++)
+			{
+				long e = ((long)rgb[c] - lvl[c]) * ((long)rgb[c] - lvl[c]);
+				if (d[c] < 0 || e < d[c])
+				{
+					d[c] = e;
+					best[c] = b & mask[c];
+				}
+			}
+		}
+		img->px[k] = rgb332_565(best[0] | best[1] | best[2]);
+		err += d[0] + d[1] + d[2];
+	}
+	return err > 0 ? 10 * log10(255.0 * 255.0 * 3 * total / err) : 99.0;
+}
@@ -0,0 +1,220 @@
+// imgstream: sends stream frames written by tools/imgconv -s to Versuch4
+// built with -DSTREAM=1 (frame layout and flow control in
+// Projekt_Versuch4.X/stream.h). The board acknowledges every freed half of
+// its receive buffer, so the sender never has more bytes in flight than the
+// buffer holds.
+//
+// usage: imgstream [-b baud] [-x x] [-y y] [-d ms] [-l] device file.s65...
+//   -b  baud rate (default 1000000), one of speeds[], ignored on a pty
+//   -x  -y  position on the screen (default: as in the frame, imgconv
+//       writes centred)
+//   -d  pause between pictures in ms (default 0)
+//   -l  loop over the files until interrupted
+//
+// With simavr: simbench -u prints the pty of the simulated UART, e.g.
+//   simbench -u -c 1600000000 Versuch4.elf Display_DrawRLE &
+//   imgstream /dev/pts/3 a.s65 b.s65
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+// same values as stream.h
+#define STREAM_BUFFER 256
+#define STREAM_HALF (STREAM_BUFFER / 2)
+#define STREAM_WINDOW (STREAM_BUFFER - 1)
+#define STREAM_ACK 0x2B
+#define STREAM_HEADER 9
+
+#define ACK_TIMEOUT_MS 2000
+
+static long credit = STREAM_WINDOW;
+
+static const struct
+{
+	long baud;
+	speed_t speed;
+} speeds[] = {
+	{115200, B115200}, {230400, B230400}, {460800, B460800}, {500000, B500000},
+	{921600, B921600}, {1000000, B1000000}, {2000000, B2000000},
+};
+
+// 1 if fd is the slave side of a pseudo terminal (simavr), where the baud
+// rate has no effect
+static int is_pty(int fd)
+{
+	const char *name = ttyname(fd);
+	return name && strncmp(name, "/dev/pts/", 9) == 0;
+}
+
+// opens the port raw at baud, exits with 2 on a baud rate missing from
+// speeds[] unless the port is a pty
+static int open_port(const char *path, long baud)
+{
+	struct termios t;
+	int fd = open(path, O_RDWR | O_NOCTTY);
+	size_t k;
+
+	if (fd < 0)
+		return -1;
+	for (k = 0; k < sizeof(speeds) / sizeof(speeds[0]); k++)
+		if (speeds[k].baud == baud)
+			break;
+	if (k == sizeof(speeds) / sizeof(speeds[0]) && !is_pty(fd))
+	{
+		fprintf(stderr, "imgstream: unsupported baud rate %ld\n", baud);
+		exit(2);
+	}
+	if (tcgetattr(fd, &t) == 0)
+	{
+		cfmakeraw(&t);
+		if (k < sizeof(speeds) / sizeof(speeds[0]))
+		{
+			cfsetispeed(&t, speeds[k].speed);
+			cfsetospeed(&t, speeds[k].speed);
+		}
+		if (tcsetattr(fd, TCSANOW, &t) != 0)
+			fprintf(stderr, "imgstream: %s: cannot set %ld baud\n", path, baud);
+	}
+	return fd;
+}
+
+// collect acknowledges, waits up to timeout_ms for the first one
+static int read_acks(int fd, int timeout_ms)
+{
+	struct pollfd p = {fd, POLLIN, 0};
+	uint8_t buf[64];
+	ssize_t n;
+
+	if (poll(&p, 1, timeout_ms) <= 0)
+		return timeout_ms ? -1 : 0;
+	n = read(fd, buf, sizeof(buf));
+	for (ssize_t k = 0; k < n; k++)
+		if (buf[k] == STREAM_ACK)
+			credit += STREAM_HALF;
+	return 0;
+}
+
+static int send_frame(int fd, const uint8_t *data, long size)
+{
+	long sent = 0, n;
+
+	while (sent < size)
+	{
+		read_acks(fd, 0);
+		if (credit == 0 && read_acks(fd, ACK_TIMEOUT_MS) != 0)
+		{
+			fprintf(stderr, "imgstream: no acknowledge from the board\n");
+			return -1;
+		}
+		n = size - sent < credit ? size - sent : credit;
+		n = write(fd, data + sent, n);
+		if (n < 0)
+		{
+			perror("imgstream: write");
+			return -1;
+		}
+		sent += n;
+		credit -= n;
+	}
+	return 0;
+}
+
+static uint8_t *load(const char *path, long *size)
+{
+	FILE *f = fopen(path, "rb");
+	uint8_t *data;
+
+	if (!f)
+		return NULL;
+	fseek(f, 0, SEEK_END);
+	*size = ftell(f);
+	rewind(f);
+	data = malloc(*size > 0 ? *size : 1);
+	if (*size < STREAM_HEADER || fread(data, 1, *size, f) != (size_t)*size || data[0] != 'S' || data[1] != '6')
+	{
+		fclose(f);
+		free(data);
+		return NULL;
+	}
+	fclose(f);
+	return data;
+}
+
+static void usage(void)
+{
+	fprintf(stderr, "usage: imgstream [-b baud] [-x x] [-y y] [-d ms] [-l] device file.s65...\n");
+	exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+	long baud = 1000000, size;
+	int x = -1, y = -1, delay = 0, loop = 0, fd, k, first;
+	const char *device = NULL;
+	struct timespec t0, t1;
+	uint8_t *data;
+	double secs;
+
+	for (k = 1; k < argc && argv[k][0] == '-'; k++)
+	{
+		if (strcmp(argv[k], "-b") == 0 && k + 1 < argc)
+			baud = atol(argv[++k]);
+		else if (strcmp(argv[k], "-x") == 0 && k + 1 < argc)
+			x = atoi(argv[++k]);
+		else if (strcmp(argv[k], "-y") == 0 && k + 1 < argc)
+			y = atoi(argv[++k]);
+		else if (strcmp(argv[k], "-d") == 0 && k + 1 < argc)
+			delay = atoi(argv[++k]);
+		else if (strcmp(argv[k], "-l") == 0)
+			loop = 1;
+		else
+			usage();
+	}
+	if (k + 2 > argc)
+		usage();
+	device = argv[k++];
+	first = k;
+	if ((fd = open_port(device, baud)) < 0)
+	{
+		perror(device);
+		return 1;
+	}
+
+	printf("file\tbytes\tseconds\tkB_per_s\n");
+	do
+	{
+		for (k = first; k < argc; k++)
+		{
+			if (!(data = load(argv[k], &size)))
+			{
+				fprintf(stderr, "imgstream: %s is no stream frame\n", argv[k]);
+				return 1;
+			}
+			if (x >= 0)
+				data[3] = x;
+			if (y >= 0)
+				data[4] = y;
+			clock_gettime(CLOCK_MONOTONIC, &t0);
+			if (send_frame(fd, data, size) != 0)
+				return 1;
+			tcdrain(fd);
+			clock_gettime(CLOCK_MONOTONIC, &t1);
+			secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+			printf("%s\t%ld\t%.3f\t%.1f\n", argv[k], size, secs, size / secs / 1000);
+			fflush(stdout);
+			free(data);
+			if (delay)
+				usleep(delay * 1000L);
+		}
+	} while (loop);
+	close(fd);
+	return 0;
+}
@@ -0,0 +1,279 @@
+// mapreport: flash cost of every function in a firmware image, read from
+// the GNU ld map file the MPLAB X link writes (-Wl,-Map, next to the ELF in
+// dist/default/production). The projects compile with -ffunction-sections,
+// so every function that is not inlined is its own input section
+// .text.<name> in the map, with its size and the object (or library member)
+// it came from.
+//
+// usage: mapreport [-b bench.tsv] [-p project] file.map [function...]
+//   -b  add the cycle columns of tools/simbench (or run_bench.sh) output
+//   -p  only use the bench rows of this project (first column of
+//       run_bench.sh, e.g. Versuch4)
+//   function...  only these functions, in this order. A function without
+//       a section of its own is printed with 0 bytes and object "-": it was
+//       inlined into its callers, removed by --gc-sections or does not
+//       exist in this image.
+//
+// Output is tab separated, largest function first:
+//   function bytes object [calls avg_cycles max_cycles]
+// followed by the totals of the image, flash (code, const tables, initial
+// values of .data) and RAM (.data, .rodata, .bss), the same numbers as the
+// memory summary of MPLAB X.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_FUNCS 512
+#define MAX_NAME 128
+#define MAX_PATH 256
+
+typedef struct
+{
+	char name[MAX_NAME];
+	char object[MAX_PATH];
+	unsigned long bytes;
+	char calls[32], avg[32], max[32]; // from the bench, "" if not measured
+} Func;
+
+static Func funcs[MAX_FUNCS];
+static int nfuncs;
+static unsigned long flash_size, ram_size;
+
+static Func *find(const char *name)
+{
+	int k;
+	for (k = 0; k < nfuncs; k++)
+		if (strcmp(funcs[k].name, name) == 0)
+			return &funcs[k];
+	return NULL;
+}
+
+// one input section: name without ".text.", size and object
+static void add(const char *name, unsigned long bytes, const char *object)
+{
+	Func *f = find(name);
+	const char *base, *end;
+
+	if (bytes == 0)
+		return;
+	if (!f)
+	{
+		if (nfuncs == MAX_FUNCS)
+			return;
+		f = &funcs[nfuncs++];
+		snprintf(f->name, sizeof(f->name), "%s", name);
+		// build/default/production/main.o => main.o,
+		// c:/.../avr5\libc.a(exit.o) => libc.a(exit.o)
+		end = strchr(object, '(') ? strchr(object, '(') : object + strlen(object);
+		for (base = end; base > object && base[-1] != '/' && base[-1] != '\\'; base--)
+			;
+		snprintf(f->object, sizeof(f->object), "%s", base);
+	}
+	f->bytes += bytes; // a name can come from several objects (static functions)
+}
+
+// output section: flash (code, tables and the load image of .data) and RAM
+static void add_total(const char *name, unsigned long addr, unsigned long size)
+{
+	static const char *const skip[] = {".debug", ".comment", ".stab", ".stack", ".note"};
+	unsigned k;
+
+	for (k = 0; k < sizeof(skip) / sizeof(skip[0]); k++)
+		if (strncmp(name, skip[k], strlen(skip[k])) == 0)
+			return;
+	if (addr < 0x800000)
+		flash_size += size;
+	else if (addr < 0x810000) // data space, the EEPROM starts at 0x810000
+	{
+		ram_size += size;
+		if (strncmp(name, ".bss", 4) != 0 && strncmp(name, ".noinit", 7) != 0)
+			flash_size += size; // initial values are copied from flash
+	}
+}
+
+// Sections are listed as ".name 0xaddr 0xsize" (output section, column 0)
+// and " .name 0xaddr 0xsize object" (input section), a long name stands
+// alone and the numbers follow on the next line. The object path can
+// contain spaces. Only the part after "Linker script and memory map"
+// counts, the discarded sections before it are not in the image.
+static int read_map(FILE *f)
+{
+	char line[1024], name[MAX_NAME] = "", *object;
+	unsigned long addr, size;
+	int in_map = 0, out = 0, n, pos;
+	const char *numbers;
+
+	while (fgets(line, sizeof(line), f))
+	{
+		line[strcspn(line, "\r\n")] = 0;
+		if (!in_map)
+		{
+			in_map = strncmp(line, "Linker script and memory map", 28) == 0;
+			continue;
+		}
+		if (line[0] == '.' || strncmp(line, " .", 2) == 0) // new section
+		{
+			out = line[0] == '.';
+			if (sscanf(line, " %127s%n", name, &pos) != 1)
+				continue;
+			numbers = line + pos;
+		}
+		else if (name[0] && line[0] == ' ') // numbers of the section on the line before
+			numbers = line;
+		else
+		{
+			name[0] = 0;
+			continue;
+		}
+		n = sscanf(numbers, " %lx %lx %n", &addr, &size, &pos);
+		if (n < 2)
+			continue; // name alone, or a pattern like *(.text)
+		if (out)
+			add_total(name, addr, size);
+		else if (strncmp(name, ".text.", 6) == 0)
+		{
+			object = (char *)numbers + pos;
+			add(name + 6, size, object);
+		}
+		name[0] = 0;
+	}
+	return in_map;
+}
+
+// join the columns of a simbench table (header line with "symbol")
+static int read_bench(FILE *f, const char *project)
+{
+	char line[1024], *col[16], *p;
+	int n, k, c_project = -1, c_symbol = -1, c_calls = -1, c_avg = -1, c_max = -1;
+	Func *fn;
+
+	while (fgets(line, sizeof(line), f))
+	{
+		line[strcspn(line, "\r\n")] = 0;
+		for (n = 0, p = strtok(line, "\t"); p && n < 16; p = strtok(NULL, "\t"))
+			col[n++] = p;
+		if (c_symbol < 0)
+		{
+			for (k = 0; k < n; k++)
+			{
+				if (strcmp(col[k], "project") == 0)
+					c_project = k;
+				else if (strcmp(col[k], "symbol") == 0)
+					c_symbol = k;
+				else if (strcmp(col[k], "calls") == 0)
+					c_calls = k;
+				else if (strcmp(col[k], "avg_cycles") == 0)
+					c_avg = k;
+				else if (strcmp(col[k], "max_cycles") == 0)
+					c_max = k;
+			}
+			continue;
+		}
+		if (c_symbol >= n || c_calls >= n || c_avg >= n || c_max >= n || c_calls < 0 || c_avg < 0 || c_max < 0)
+			continue;
+		if (project && c_project >= 0 && (c_project >= n || strcmp(col[c_project], project) != 0))
+			continue;
+		if (!(fn = find(col[c_symbol])) || fn->calls[0]) // first row of a symbol wins
+			continue;
+		snprintf(fn->calls, sizeof(fn->calls), "%s", col[c_calls]);
+		snprintf(fn->avg, sizeof(fn->avg), "%s", col[c_avg]);
+		snprintf(fn->max, sizeof(fn->max), "%s", col[c_max]);
+	}
+	return c_symbol >= 0;
+}
+
+static int by_size(const void *a, const void *b)
+{
+	const Func *x = a, *y = b;
+	if (x->bytes != y->bytes)
+		return x->bytes < y->bytes ? 1 : -1;
+	return strcmp(x->name, y->name);
+}
+
+static void print(const Func *f, int bench)
+{
+	printf("%s\t%lu\t%s", f->name, f->bytes, f->object);
+	if (bench)
+	{
+		if (f->calls[0])
+			printf("\t%s\t%s\t%s", f->calls, f->avg, f->max);
+		else
+			printf("\t-\t-\t-");
+	}
+	printf("\n");
+}
+
+static void usage(void)
+{
+	fprintf(stderr, "usage: mapreport [-b bench.tsv] [-p project] file.map [function...]\n");
+	exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *bench = NULL, *project = NULL, *map = NULL;
+	FILE *f;
+	Func *fn;
+	int k;
+
+	for (k = 1; k < argc; k++)
+	{
+		if (strcmp(argv[k], "-b") == 0 && k + 1 < argc)
+			bench = argv[++k];
+		else if (strcmp(argv[k], "-p") == 0 && k + 1 < argc)
+			project = argv[++k];
+		else if (argv[k][0] == '-')
+			usage();
+		else
+		{
+			map = argv[k++];
+			break;
+		}
+	}
+	if (!map)
+		usage();
+
+	if (!(f = fopen(map, "r")))
+	{
+		perror(map);
+		return 1;
+	}
+	if (!read_map(f))
+	{
+		fprintf(stderr, "mapreport: %s: no memory map in it\n", map);
+		return 1;
+	}
+	fclose(f);
+	if (bench)
+	{
+		if (!(f = fopen(bench, "r")))
+		{
+			perror(bench);
+			return 1;
+		}
+		if (!read_bench(f, project))
+			fprintf(stderr, "mapreport: %s: no symbol column\n", bench);
+		fclose(f);
+	}
+
+	printf("function\tbytes\tobject%s\n", bench ? "\tcalls\tavg_cycles\tmax_cycles" : "");
+	if (k < argc)
+	{
+		for (; k < argc; k++)
+		{
+			if ((fn = find(argv[k])))
+				print(fn, bench != NULL);
+			else
+				printf("%s\t0\t-%s\n", argv[k], bench ? "\t-\t-\t-" : "");
+		}
+	}
+	else
+	{
+		qsort(funcs, nfuncs, sizeof(Func), by_size);
+		for (k = 0; k < nfuncs; k++)
+			print(&funcs[k], bench != NULL);
+	}
+	printf("total\tflash %lu bytes\tRAM %lu bytes\n", flash_size, ram_size);
+	return 0;
+}
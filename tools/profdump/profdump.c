@@ -0,0 +1,130 @@
+// profdump: decodes the profiling frames Versuch4 sends over UART when it
+// is built with PROFILE 1 (frame layout in S65Driver/prof.h).
+// Bytes are read until a sync word with a valid checksum is found, so it
+// can be attached to a running board at any time.
+//
+// usage: profdump [-n frames] [file]
+//   -n  stop after this many frames (default: run until end of input)
+//   file  capture or serial device (default: stdin), e.g.
+//         stty -F /dev/ttyUSB0 115200 raw && profdump /dev/ttyUSB0
+//
+// Every frame is printed as one header line and one tab separated line per
+// section, the same columns as tools/simbench where they exist:
+//   section calls avg_us max_us total_ms
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define PROF_VERSION 2
+#define HEADER 19 // bytes before the sections
+#define MAX_SECTIONS 16
+
+static const char *names[] = {"init", "fill", "blit", "isr", "waitms"};
+
+static uint32_t get16(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8);
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+	return get16(p) | (get16(p + 2) << 16);
+}
+
+// Read one frame. Returns the number of sections, 0 at end of input.
+static int read_frame(FILE *f, uint8_t *frame)
+{
+	int c, prev = -1, n, size, k;
+	uint8_t sum;
+
+	for (;;)
+	{
+		c = fgetc(f);
+		if (c == EOF)
+			return 0;
+		if (prev != 0xA5 || c != 0x5A)
+		{
+			prev = c;
+			continue;
+		}
+		prev = -1;
+		if (fread(frame + 2, 1, 3, f) != 3)
+			return 0;
+		n = frame[3];
+		if (frame[2] != PROF_VERSION || n == 0 || n > MAX_SECTIONS)
+			continue;
+		size = HEADER + 10 * n + 1;
+		if (fread(frame + 5, 1, size - 5, f) != (size_t)(size - 5))
+			return 0;
+		for (sum = 0, k = 2; k < size - 1; k++)
+			sum += frame[k];
+		if (sum == frame[size - 1])
+			return n;
+		fprintf(stderr, "profdump: checksum error, frame skipped\n");
+	}
+}
+
+static void usage(void)
+{
+	fprintf(stderr, "usage: profdump [-n frames] [file]\n");
+	exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+	uint8_t frame[HEADER + 10 * MAX_SECTIONS + 1];
+	long frames = -1;
+	const char *path = NULL;
+	FILE *f = stdin;
+	int k, n;
+
+	for (k = 1; k < argc; k++)
+	{
+		if (strcmp(argv[k], "-n") == 0 && k + 1 < argc)
+			frames = strtol(argv[++k], NULL, 0);
+		else if (argv[k][0] == '-')
+			usage();
+		else if (!path)
+			path = argv[k];
+		else
+			usage();
+	}
+	if (path && !(f = fopen(path, "rb")))
+	{
+		perror(path);
+		return 1;
+	}
+
+	while (frames != 0 && (n = read_frame(f, frame)) > 0)
+	{
+		double tick_us = frame[4];
+		uint32_t uptime = get32(frame + 5);
+		uint32_t spi = get32(frame + 9);
+		double sleep_ms = get32(frame + 15) * tick_us / 1000;
+
+		printf("uptime %.3f s\tspi_bytes %u (%.1f kB/s)\tisr_latency_max %.0f us\tsleep %.1f ms (%.1f %%)\n",
+			   uptime / 1000.0, spi, uptime ? spi / (double)uptime : 0.0,
+			   get16(frame + 13) * tick_us, sleep_ms, uptime ? 100 * sleep_ms / uptime : 0.0);
+		printf("section\tcalls\tavg_us\tmax_us\ttotal_ms\n");
+		for (k = 0; k < n; k++)
+		{
+			const uint8_t *s = frame + HEADER + 10 * k;
+			uint32_t calls = get16(s), total = get32(s + 2), max = get32(s + 6);
+			const char *name = k < (int)(sizeof(names) / sizeof(names[0])) ? names[k] : "?";
+			if (calls == 0)
+			{
+				printf("%s\t0\t-\t-\t-\n", name);
+				continue;
+			}
+			printf("%s\t%u\t%.0f\t%.0f\t%.1f\n", name, calls, total * tick_us / calls,
+				   max * tick_us, total * tick_us / 1000);
+		}
+		printf("\n");
+		fflush(stdout);
+		if (frames > 0)
+			frames--;
+	}
+	return 0;
+}
@@ -0,0 +1,76 @@
+#include "hal.h"
+#include "s65sim.h"
+
+// Host backend of hal.h: every byte goes into the virtual S65 display
+
+void SPI_init(void)
+{
+	S65_CS(1);
+}
+
+void SPI_begin(void)
+{
+	S65_CS(0);
+}
+
+void SPI_end(void)
+{
+	S65_CS(1);
+}
+
+void SPISend8Bit(uint8_t data)
+{
+	SPI_begin();
+	S65_Byte(data);
+	SPI_end();
+}
+
+void SPISend16Bit(uint16_t data)
+{
+	SPI_begin();
+	S65_Byte(data >> 8);
+	S65_Byte(data & 0xFF);
+	SPI_end();
+}
+
+void SPIPut8Bit(uint8_t data)
+{
+	S65_Byte(data);
+}
+
+void SPIStream16Bit(const uint16_t *data, uint16_t Anzahl)
+{
+	while (Anzahl--)
+	{
+		S65_Byte(*data >> 8);
+		S65_Byte(*data++ & 0xFF);
+	}
+}
+
+void SPIRepeat16Bit(uint16_t data, uint16_t Anzahl)
+{
+	while (Anzahl--)
+	{
+		S65_Byte(data >> 8);
+		S65_Byte(data & 0xFF);
+	}
+}
+
+void HAL_SetDC(uint8_t level)
+{
+	S65_DC(level);
+}
+
+void HAL_SetReset(uint8_t level)
+{
+	S65_ResetPin(level);
+}
+
+void init_Timer1(void)
+{
+}
+
+void Waitms(const uint32_t msWait)
+{
+	s65_stats.wait_ms += msWait;
+}
@@ -0,0 +1,334 @@
+// s65host: runs the display code of one project natively on the virtual S65
+// display. The scene is the same as in main() of the project.
+//
+// usage: s65host [-n runs] [-r rot] [-8] [-p] [-k] [-o out.ppm] [-c reference.ppm]
+//   -n  repeat the scene n times and print the throughput
+//   -r  orientation 0..3 (x 90 degrees, default DISPLAY_ORIENTATION)
+//   -8  8 bit colours (RGB332, one byte per pixel) instead of 16 bit
+//   -p  Versuch4 only: benchmark the primitives of gfx.c, text.c and
+//       keysprite.c instead of the scene
+//   -k  Versuch4 only: check the clipping of Display_FillRect and
+//       Display_DrawImage in all four orientations (exit 1 on a wrong pixel)
+//   -o  write the final screen as PPM
+//   -c  compare the final screen with a reference PPM (exit 1 on mismatch)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "hal.h"
+#include "display.h"
+#include "s65sim.h"
+
+#if S65_PROJECT == 4
+#include "picture.h"
+#include "gfx.h"
+#include "text.h"
+#include "gull.h"
+
+static const TextStyle text_style = {&Font5x7, 0x0000, 0x7E0, 1};
+#else
+#include "sprite.h"
+#include "background.h"
+#define FRAMES 100 // sprite frames, 1 s at FRAME_MS 10
+#endif
+
+static int rot = DISPLAY_ORIENTATION;
+static int colours = DISPLAY_COLOURS;
+
+static void scene(void)
+{
+	SPI_init();
+	Display_init();
+	Display_SetOrientation(rot);
+	if (colours != DISPLAY_COLOURS)
+		Display_SetColours(colours);
+#if S65_PROJECT == 4
+	Display_FillRect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, 0x7E0);
+	Display_DrawImage((DISPLAY_WIDTH - BILD1_WIDTH) / 2, (DISPLAY_HEIGHT - BILD1_HEIGHT) / 2,
+					  BILD1_WIDTH, BILD1_HEIGHT, Bild1, BILD1_LENGTH, BILD1_CODEC);
+	// gull and status line as after 12.3 s
+	KeySprite_draw(&Gull, 96, 8);
+	{
+		TextField uptime;
+		char text[TEXT_FIELD_MAX + 1];
+		uint8_t x = 4 + Text_draw(4, DISPLAY_HEIGHT - 12, "Laufzeit", &text_style);
+		TextField_init(&uptime, x, DISPLAY_HEIGHT - 12, 7, &text_style);
+		TextField_set(&uptime, Text_formatFixed(text, 123, 1, 7));
+		Text_draw(x + 7 * Text_cellWidth(&text_style), DISPLAY_HEIGHT - 12, " s", &text_style);
+	}
+#else
+	Sprite *s;
+	Sprite_init(0xFFE0);
+	Sprite_add(35, 90, 20, 15, 1, 0x7E0, 0);
+	s = Sprite_add(10, 10, 8, 8, 2, 0xF800, 0);
+	s->vx = 1;
+	s->vy = 1;
+	s->flags |= SPRITE_BOUNCE;
+	s = Sprite_add(100, 95, 12, 6, 0, 0x001F, 0);
+	s->vx = -1;
+	s->flags |= SPRITE_BOUNCE;
+	Sprite_setBackground(&Background, 1);
+	Sprite_render();
+	for (int f = 0; f < FRAMES; f++)
+	{
+		Sprite_update();
+		Sprite_render();
+	}
+#endif
+}
+
+#if S65_PROJECT == 4
+#define BENCH_SHAPES 50
+#define BENCH_WINDOW_BYTES 12 // 6 command words per window
+
+static uint32_t seed = 1;
+
+// reproducible on every host
+static int rnd(int n)
+{
+	seed = seed * 1103515245 + 12345;
+	return (seed >> 16) % n;
+}
+
+static void bench_shape(int kind)
+{
+	int w = DISPLAY_WIDTH, h = DISPLAY_HEIGHT;
+	int x = rnd(w), y = rnd(h), r = 5 + rnd(40);
+	GfxPoint p[5];
+
+	switch (kind)
+	{
+	case 0:
+		Gfx_Line(x, y, rnd(w), rnd(h), 0xFFFF);
+		break;
+	case 1:
+		Gfx_Rect(x - r, y - r, 2 * r, r + rnd(r), 0xFFFF);
+		break;
+	case 2:
+		Gfx_Circle(x, y, r, 0xFFFF);
+		break;
+	case 3:
+		Gfx_FillCircle(x, y, r, 0xFFFF);
+		break;
+	case 4:
+		Gfx_Ellipse(x, y, r, 5 + rnd(40), 0xFFFF);
+		break;
+	case 5:
+		Gfx_FillEllipse(x, y, r, 5 + rnd(40), 0xFFFF);
+		break;
+	case 6:
+		Gfx_RoundRect(x - r, y - r, 2 * r, r + rnd(r), 2 + rnd(8), 0xFFFF);
+		break;
+	case 7:
+		Gfx_FillRoundRect(x - r, y - r, 2 * r, r + rnd(r), 2 + rnd(8), 0xFFFF);
+		break;
+	case 8:
+		for (int k = 0; k < 5; k++)
+		{
+			p[k].x = x + rnd(2 * r) - r;
+			p[k].y = y + rnd(2 * r) - r;
+		}
+		Gfx_FillPolygon(p, 5, 0xFFFF);
+		break;
+	case 9:
+		Text_draw(x / 2, y, "Status 123.4 V", &text_style);
+		break;
+	case 10: // a counter in a field, one step per shape
+		{
+			static TextField field;
+			static int32_t count;
+			char text[TEXT_FIELD_MAX + 1];
+			if (!count)
+				TextField_init(&field, 10, 10, 8, &text_style);
+			TextField_set(&field, Text_formatFixed(text, count++, 1, 8));
+		}
+		break;
+	case 11: // the gull, a few pixels further each time
+		{
+			static int16_t gx = 80, gy = 60;
+			int16_t nx = gx + rnd(7) - 3, ny = gy + rnd(7) - 3;
+			KeySprite_move(&Gull, gx, gy, nx, ny, 0x0000);
+			gx = nx;
+			gy = ny;
+		}
+		break;
+	default:
+		fprintf(stderr, "s65host: no benchmark shape %d\n", kind);
+		exit(2);
+	}
+}
+
+// Pixels per second of every primitive on the target bus, from the bytes
+// on the bus (S65_CYCLES_PER_BYTE). The CPU time of the rasterizer itself
+// is not part of it, it overlaps only partly with the bus. per_pixel_ms is
+// the same set of pixels with a window per pixel.
+static void bench_primitives(void)
+{
+	static const char *names[] = {"line", "rect", "circle", "fill_circle", "ellipse",
+								  "fill_ellipse", "round_rect", "fill_round_rect", "fill_polygon",
+								  "text_line", "text_field", "key_sprite_move"};
+	double ms, naive;
+
+	printf("primitive\tshapes\twindows\tpixels\tbus_ms\tpixels_per_s\tper_pixel_ms\n");
+	for (int kind = 0; kind < (int)(sizeof(names) / sizeof(names[0])); kind++)
+	{
+		S65_Reset();
+		SPI_init();
+		Display_SetOrientation(rot);
+		Display_SetColours(colours);
+		for (int k = 0; k < BENCH_SHAPES; k++)
+			bench_shape(kind);
+		ms = S65_EstimatedMs();
+		naive = s65_stats.pixels * (BENCH_WINDOW_BYTES + colours / 8.0) * S65_CYCLES_PER_BYTE * 1000.0 / S65_CPU_HZ;
+		printf("%s\t%d\t%llu\t%llu\t%.1f\t%.0f\t%.1f\n", names[kind], BENCH_SHAPES,
+			   (unsigned long long)s65_stats.commands / 6, (unsigned long long)s65_stats.pixels,
+			   ms, s65_stats.pixels * 1000.0 / ms, naive);
+	}
+}
+
+// Bild1 is drawn on the screen, partly and completely off it in every
+// orientation. Every screen pixel is compared with the background or with
+// the picture as drawn once completely visible (Querformat, top left).
+// Returns the number of wrong pixels.
+static long check_clipping(void)
+{
+	static uint16_t ref[BILD1_HEIGHT][BILD1_WIDTH];
+	long wrong = 0, n;
+	int r, k, x, y, px, py, w, h;
+	uint16_t bg, expect;
+
+	S65_Reset();
+	SPI_init();
+	Display_init();
+	Display_SetOrientation(DISPLAY_ROT_90);
+	Display_SetColours(colours);
+	Display_DrawImage(0, 0, BILD1_WIDTH, BILD1_HEIGHT, Bild1, BILD1_LENGTH, BILD1_CODEC);
+	for (y = 0; y < BILD1_HEIGHT; y++)
+		for (x = 0; x < BILD1_WIDTH; x++)
+			ref[y][x] = S65_Pixel(DISPLAY_ROT_90, x, y);
+
+	for (r = 0; r < 4; r++)
+	{
+		Display_SetOrientation(r);
+		w = DISPLAY_WIDTH;
+		h = DISPLAY_HEIGHT;
+		{
+			const int pos[][2] = {
+				{(w - BILD1_WIDTH) / 2, (h - BILD1_HEIGHT) / 2}, // centred, cut in Hochformat
+				{-30, -20},										 // top left corner
+				{w - 40, h - 25},								 // bottom right corner
+				{-BILD1_WIDTH, 0},								 // just left of the screen
+				{w, h},											 // beyond the bottom right corner
+			};
+			for (k = 0; k < (int)(sizeof(pos) / sizeof(pos[0])); k++)
+			{
+				px = pos[k][0];
+				py = pos[k][1];
+				Display_FillRect(-10, -10, w + 20, h + 20, 0x7E0); // whole screen and more
+				bg = S65_Pixel(r, 0, 0);
+				Display_DrawImage(px, py, BILD1_WIDTH, BILD1_HEIGHT, Bild1, BILD1_LENGTH, BILD1_CODEC);
+				n = 0;
+				for (y = 0; y < h; y++)
+					for (x = 0; x < w; x++)
+					{
+						if (x >= px && x < px + BILD1_WIDTH && y >= py && y < py + BILD1_HEIGHT)
+							expect = ref[y - py][x - px];
+						else
+							expect = bg;
+						n += S65_Pixel(r, x, y) != expect;
+					}
+				if (n)
+					printf("rot %d at (%d, %d): %ld wrong pixels\n", r, px, py, n);
+				wrong += n;
+			}
+		}
+	}
+	printf("clipping\t%s\n", wrong ? "wrong" : "ok");
+	return wrong;
+}
+#endif
+
+int main(int argc, char *argv[])
+{
+	long runs = 1;
+	const char *out = NULL, *ref = NULL;
+#if S65_PROJECT == 4
+	int primitives = 0, check = 0;
+#endif
+	struct timespec t0, t1;
+	double secs;
+
+	for (int k = 1; k < argc; k++)
+	{
+		if (strcmp(argv[k], "-n") == 0 && k + 1 < argc)
+			runs = atol(argv[++k]);
+		else if (strcmp(argv[k], "-r") == 0 && k + 1 < argc)
+			rot = atoi(argv[++k]) & 3;
+		else if (strcmp(argv[k], "-8") == 0)
+			colours = DISPLAY_COLOURS_8;
+		else if (strcmp(argv[k], "-o") == 0 && k + 1 < argc)
+			out = argv[++k];
+#if S65_PROJECT == 4
+		else if (strcmp(argv[k], "-p") == 0)
+			primitives = 1;
+		else if (strcmp(argv[k], "-k") == 0)
+			check = 1;
+#endif
+		else if (strcmp(argv[k], "-c") == 0 && k + 1 < argc)
+			ref = argv[++k];
+		else
+		{
+			fprintf(stderr, "usage: s65host [-n runs] [-r rot] [-8] [-p] [-k] [-o out.ppm] [-c reference.ppm]\n");
+			return 2;
+		}
+	}
+	if (runs < 1)
+		runs = 1;
+#if S65_PROJECT == 4
+	if (primitives)
+	{
+		bench_primitives();
+		return 0;
+	}
+	if (check)
+		return check_clipping() != 0;
+#endif
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (long r = 0; r < runs; r++)
+	{
+		S65_Reset();
+		scene();
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+
+	printf("bytes\t%llu\n", (unsigned long long)s65_stats.bytes);
+	printf("commands\t%llu\n", (unsigned long long)s65_stats.commands);
+	printf("pixels\t%llu\n", (unsigned long long)s65_stats.pixels);
+	printf("transactions\t%llu\n", (unsigned long long)s65_stats.transactions);
+	printf("dropped\t%llu\n", (unsigned long long)s65_stats.dropped);
+	printf("rejected\t%llu\n", (unsigned long long)s65_stats.rejected);
+	printf("wait_ms\t%llu\n", (unsigned long long)s65_stats.wait_ms);
+	printf("target_bus_ms\t%.1f\n", S65_EstimatedMs());
+	printf("host_runs_per_s\t%.0f\n", runs / secs);
+
+	if (out && S65_WritePPM(out, rot) != 0)
+	{
+		perror(out);
+		return 1;
+	}
+	if (ref)
+	{
+		long diff = S65_ComparePPM(ref, rot);
+		if (diff < 0)
+		{
+			fprintf(stderr, "s65host: cannot read %s\n", ref);
+			return 1;
+		}
+		printf("diff_pixels\t%ld\n", diff);
+		return diff != 0;
+	}
+	return 0;
+}
@@ -0,0 +1,240 @@
+#include <stdio.h>
+#include <string.h>
+#include "s65sim.h"
+
+// Decoder for the command/data stream of the S65 display.
+// Bytes are paired into 16 bit words. With D_C high a word is a command
+// (high byte = register, low byte = value), with D_C low it is a pixel.
+// Only the window registers on page 0xEF08 are modelled:
+//   0x12 x start, 0x15 x end, 0x13 y start, 0x16 y end, 0x18 address mode.
+// Bit 0x04 of the address mode makes y the fast axis (used by the
+// Querformat mode 0x05), the directions follow from start <= end.
+// Command 0xE8 selects the colour mode on page 0xEF08, where the init sends
+// it: low nibble 0 is RGB332, one byte per pixel (stored widened to RGB565),
+// anything else RGB565. On any other page it is rejected (counted, the mode
+// stays), the model does not know what it does there.
+
+uint16_t s65_ram[S65_RAM_H][S65_RAM_W];
+S65Stats s65_stats;
+
+static uint8_t cs = 1, dc, phase, high;
+static uint8_t page, mode, colour8;
+static uint8_t x_start, x_end, y_start, y_end = S65_RAM_H - 1, cx, cy;
+
+void S65_Reset(void)
+{
+	memset(s65_ram, 0, sizeof(s65_ram));
+	memset(&s65_stats, 0, sizeof(s65_stats));
+	cs = 1;
+	dc = phase = 0;
+	page = mode = colour8 = 0;
+	x_start = y_start = cx = cy = 0;
+	x_end = S65_RAM_W - 1;
+	y_end = S65_RAM_H - 1;
+}
+
+void S65_CS(uint8_t level)
+{
+	if (cs && !level)
+		s65_stats.transactions++;
+	cs = level;
+}
+
+void S65_DC(uint8_t level)
+{
+	if (level != dc)
+		phase = 0;
+	dc = level;
+}
+
+void S65_ResetPin(uint8_t level)
+{
+	if (!level)
+	{
+		phase = 0;
+		page = mode = colour8 = 0;
+	}
+}
+
+static void command(uint16_t word)
+{
+	uint8_t reg = word >> 8, val = word & 0xFF;
+	s65_stats.commands++;
+	if (reg == 0xEF)
+	{
+		page = val;
+		return;
+	}
+	if (page != 0x08)
+	{
+		if (reg == 0xE8)
+			s65_stats.rejected++;
+		return;
+	}
+	if (reg == 0xE8)
+	{
+		colour8 = !(val & 0x0F);
+		return;
+	}
+	switch (reg)
+	{
+	case 0x12:
+		x_start = val;
+		break;
+	case 0x15:
+		x_end = val;
+		break;
+	case 0x13:
+		y_start = val;
+		break;
+	case 0x16:
+		y_end = val;
+		break;
+	case 0x18:
+		mode = val;
+		break;
+	default:
+		return;
+	}
+	cx = x_start;
+	cy = y_start;
+}
+
+static void pixel(uint16_t colour)
+{
+	int dx = (x_end >= x_start) ? 1 : -1;
+	int dy = (y_end >= y_start) ? 1 : -1;
+
+	if (cx < S65_RAM_W && cy < S65_RAM_H)
+		s65_ram[cy][cx] = colour;
+	s65_stats.pixels++;
+
+	if (mode & 0x04) // y fastest
+	{
+		if (cy == y_end)
+		{
+			cy = y_start;
+			cx = (cx == x_end) ? x_start : cx + dx;
+		}
+		else
+			cy += dy;
+	}
+	else
+	{
+		if (cx == x_end)
+		{
+			cx = x_start;
+			cy = (cy == y_end) ? y_start : cy + dy;
+		}
+		else
+			cx += dx;
+	}
+}
+
+void S65_Byte(uint8_t b)
+{
+	uint16_t word;
+	s65_stats.bytes++;
+	if (cs)
+	{
+		s65_stats.dropped++;
+		return;
+	}
+	if (colour8 && !dc) // RRRGGGBB, bits repeated as the firmware's RGB332_TO_565
+	{
+		pixel(((b & 0xE0) << 8) | ((b & 0xC0) << 5) | ((b & 0x1C) << 6) | ((b & 0x1C) << 3) |
+			  ((b & 0x03) << 3) | ((b & 0x03) << 1) | ((b & 0x02) >> 1));
+		return;
+	}
+	if (!phase)
+	{
+		high = b;
+		phase = 1;
+		return;
+	}
+	phase = 0;
+	word = (high << 8) | b;
+	if (dc)
+		command(word);
+	else
+		pixel(word);
+}
+
+// the mapping of Display_WindowWords: 90 degrees clockwise per step
+uint16_t S65_Pixel(int rot, int x, int y)
+{
+	switch (rot)
+	{
+	case 1: // Querformat: screen x is controller y, screen y runs down controller x
+		return s65_ram[x][S65_RAM_W - 1 - y];
+	case 2:
+		return s65_ram[S65_RAM_H - 1 - y][S65_RAM_W - 1 - x];
+	case 3:
+		return s65_ram[S65_RAM_H - 1 - x][y];
+	default:
+		return s65_ram[y][x];
+	}
+}
+
+static void to_rgb(uint16_t c, unsigned char *rgb)
+{
+	rgb[0] = ((c >> 11) & 0x1F) * 255 / 31;
+	rgb[1] = ((c >> 5) & 0x3F) * 255 / 63;
+	rgb[2] = (c & 0x1F) * 255 / 31;
+}
+
+int S65_WritePPM(const char *path, int rot)
+{
+	int w = (rot & 1) ? S65_RAM_H : S65_RAM_W;
+	int h = (rot & 1) ? S65_RAM_W : S65_RAM_H;
+	unsigned char rgb[3];
+	FILE *f = fopen(path, "wb");
+	if (!f)
+		return -1;
+	fprintf(f, "P6\n%d %d\n255\n", w, h);
+	for (int y = 0; y < h; y++)
+		for (int x = 0; x < w; x++)
+		{
+			to_rgb(S65_Pixel(rot, x, y), rgb);
+			fwrite(rgb, 1, 3, f);
+		}
+	return fclose(f);
+}
+
+// number of pixels that differ from a reference PPM, -1 if it cannot be read
+long S65_ComparePPM(const char *path, int rot)
+{
+	int w = (rot & 1) ? S65_RAM_H : S65_RAM_W;
+	int h = (rot & 1) ? S65_RAM_W : S65_RAM_H;
+	int fw, fh, max;
+	long diff = 0;
+	unsigned char rgb[3], ref[3];
+	FILE *f = fopen(path, "rb");
+	if (!f)
+		return -1;
+	if (fscanf(f, "P6 %d %d %d", &fw, &fh, &max) != 3 || fw != w || fh != h || max != 255 || fgetc(f) == EOF)
+	{
+		fclose(f);
+		return -1;
+	}
+	for (int y = 0; y < h; y++)
+		for (int x = 0; x < w; x++)
+		{
+			if (fread(ref, 1, 3, f) != 3)
+			{
+				fclose(f);
+				return -1;
+			}
+			to_rgb(S65_Pixel(rot, x, y), rgb);
+			if (memcmp(rgb, ref, 3) != 0)
+				diff++;
+		}
+	fclose(f);
+	return diff;
+}
+
+// bus time of everything sent since S65_Reset() on the real target
+double S65_EstimatedMs(void)
+{
+	return s65_stats.bytes * (double)S65_CYCLES_PER_BYTE * 1000.0 / S65_CPU_HZ;
+}
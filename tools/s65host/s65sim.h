@@ -0,0 +1,42 @@
+#ifndef _S65SIM_H_
+
+#define _S65SIM_H_
+
+#include <stdint.h>
+
+// Virtual S65 display (LS020 controller) for the host build.
+// The RAM is kept in controller coordinates: x 0..131, y 0..175.
+
+#define S65_RAM_W 132
+#define S65_RAM_H 176
+
+#define S65_CPU_HZ 16000000UL
+#define S65_CYCLES_PER_BYTE 18 // hardware SPI at fosc/2 incl. SPIF polling
+
+typedef struct
+{
+	uint64_t bytes;		   // bytes on the bus
+	uint64_t commands;	   // command words
+	uint64_t pixels;	   // pixels written into the RAM
+	uint64_t transactions; // CS low phases
+	uint64_t wait_ms;	   // time spent in Waitms
+	uint64_t dropped;	   // bytes sent while CS was high
+	uint64_t rejected;	   // colour mode commands outside page 0xEF08
+} S65Stats;
+
+extern uint16_t s65_ram[S65_RAM_H][S65_RAM_W];
+extern S65Stats s65_stats;
+
+void S65_Reset(void);
+void S65_CS(uint8_t level);
+void S65_DC(uint8_t level);
+void S65_ResetPin(uint8_t level);
+void S65_Byte(uint8_t b);
+
+// screen pixel (x, y) in the given orientation (DISPLAY_ROT_0..270 = 0..3)
+uint16_t S65_Pixel(int rot, int x, int y);
+int S65_WritePPM(const char *path, int rot);
+long S65_ComparePPM(const char *path, int rot);
+double S65_EstimatedMs(void);
+
+#endif
@@ -0,0 +1,24 @@
+#!/bin/sh
+# Run the hot path benchmarks for both projects and print one table.
+# The ELF files are the MPLAB X production builds (build both projects
+# first, the build output is not kept in the repository), V3=... / V4=...
+# select other builds (e.g. Versuch4 built with -DHAL_TRANSPORT_USART=1).
+cd "$(dirname "$0")" || exit 1
+ROOT=../..
+V3=${V3:-$ROOT/Projekt_Versuch3.X/dist/default/production/Projekt_Versuch3.X.production.elf}
+V4=${V4:-$ROOT/Projekt_Versuch4.X/dist/default/production/Projekt_Versuch4.X.production.elf}
+
+printf 'project\tsymbol\tcalls\tmin_cycles\tmax_cycles\tavg_cycles\ttotal_cycles\tmax_us\n'
+
+# Versuch3: display init steps, sprite redraw, SPI_STC interrupt of the
+# transfer queue and the Timer0 tick. Button 1 is held from 1500 ms to
+# 2500 ms, so the scheduler tasks also move the square.
+./simbench -c 48000000 -b B1@1500:1000 "$V3" \
+	Display_initStep Boot_finishDisplay Sprite_render __vector_17 __vector_14 | tail -n +2 | sed 's/^/Versuch3\t/'
+
+# Versuch4: init, background fill and picture blit of the boot (the text,
+# the gull and the animation call the same driver functions, so these are
+# timed through their wrappers in main.c), Timer1 deadline and overflow
+# interrupts of the timer service
+./simbench -c 32000000 "$V4" \
+	Display_init Boot_background Boot_picture __vector_11 __vector_13 | tail -n +2 | sed 's/^/Versuch4\t/'
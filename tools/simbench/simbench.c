@@ -0,0 +1,342 @@
+// simbench: headless cycle benchmark for the firmware images under simavr.
+//
+// The ELF is loaded into simavr and run instruction by instruction. For
+// every probed function the harness notes the cycle counter when the PC
+// reaches the entry address and the return address on the stack, and stops
+// the clock when the PC comes back to that return address with the stack
+// pointer restored. Interrupt vectors (__vector_N) work the same way, so
+// the worst case of an ISR is just the max column of its row.
+//
+// usage: simbench [-c cycles] [-m mcu] [-f hz] [-b PORTPIN@ms:holdms]... [-u] file.elf symbol...
+//   -c  stop after this many cycles (default 32000000 = 2 s at 16 MHz)
+//   -m  mcu name if the ELF carries none (default atmega328p)
+//   -f  clock if the ELF carries none (default 16000000)
+//   -b  pull a pin low for a while, e.g. -b B1@1500:300 presses PB1 at
+//       1500 ms for 300 ms (buttons have pull-ups, so idle is high)
+//   -u  bridge UART0 to a pseudo terminal, its name is printed on stderr
+//       (tools/imgstream sends pictures to Versuch4 built with -DSTREAM=1)
+//
+// Output is one tab separated line per symbol:
+//   symbol calls min_cycles max_cycles avg_cycles total_cycles max_us
+
+#define _GNU_SOURCE // posix_openpt, ptsname
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <elf.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "sim_avr.h"
+#include "sim_elf.h"
+#include "avr_ioport.h"
+#include "avr_uart.h"
+
+#define MAX_PROBES 16
+#define MAX_BUTTONS 8
+#define UART_POLL_CYCLES 1000 // pty is read every 1000 cycles
+
+typedef struct
+{
+	const char *name;
+	uint32_t addr; // byte address in flash
+	int active;
+	uint64_t start;
+	uint16_t sp;
+	uint32_t ret; // byte address the function returns to
+	uint32_t calls;
+	uint64_t min, max, total;
+} Probe;
+
+typedef struct
+{
+	char port;
+	int pin;
+	uint64_t press, release; // cycles
+	int state;				 // 0 idle, 1 pressed, 2 done
+	avr_irq_t *irq;
+} Button;
+
+typedef struct
+{
+	int fd;	 // pty master
+	int xon; // the UART input FIFO has room
+	avr_irq_t *in;
+} UartPty;
+
+static void uart_out(struct avr_irq_t *irq, uint32_t value, void *param)
+{
+	UartPty *u = param;
+	uint8_t b = value;
+	(void)irq;
+	if (write(u->fd, &b, 1) != 1) // nobody on the other side yet
+		return;
+}
+
+static void uart_xon(struct avr_irq_t *irq, uint32_t value, void *param)
+{
+	(void)irq;
+	(void)value;
+	((UartPty *)param)->xon = 1;
+}
+
+static void uart_xoff(struct avr_irq_t *irq, uint32_t value, void *param)
+{
+	(void)irq;
+	(void)value;
+	((UartPty *)param)->xon = 0;
+}
+
+// UART0 <-> pseudo terminal, raw and non blocking
+static int uart_pty_open(avr_t *avr, UartPty *u)
+{
+	struct termios t;
+	uint32_t flags = 0;
+
+	u->fd = posix_openpt(O_RDWR | O_NOCTTY);
+	if (u->fd < 0 || grantpt(u->fd) != 0 || unlockpt(u->fd) != 0)
+		return -1;
+	if (tcgetattr(u->fd, &t) == 0)
+	{
+		cfmakeraw(&t);
+		tcsetattr(u->fd, TCSANOW, &t);
+	}
+	fcntl(u->fd, F_SETFL, O_NONBLOCK);
+
+	avr_ioctl(avr, AVR_IOCTL_UART_GET_FLAGS('0'), &flags);
+	flags &= ~AVR_UART_FLAG_STDIO; // bytes go to the pty, not to stdout
+	avr_ioctl(avr, AVR_IOCTL_UART_SET_FLAGS('0'), &flags);
+	u->in = avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_INPUT);
+	avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_OUTPUT), uart_out, u);
+	avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_OUT_XON), uart_xon, u);
+	avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_UART_GETIRQ('0'), UART_IRQ_OUT_XOFF), uart_xoff, u);
+	u->xon = 1;
+	fprintf(stderr, "simbench: uart0 on %s\n", ptsname(u->fd));
+	return 0;
+}
+
+// hand the bytes the host has written to the UART while its FIFO has room
+static void uart_pty_poll(UartPty *u)
+{
+	uint8_t b;
+	while (u->xon && read(u->fd, &b, 1) == 1)
+		avr_raise_irq(u->in, b);
+}
+
+// look up a function symbol in the ELF symbol table
+static int find_symbol(const char *path, const char *name, uint32_t *addr)
+{
+	FILE *f = fopen(path, "rb");
+	Elf32_Ehdr eh;
+	Elf32_Shdr *sh = NULL;
+	int found = 0;
+
+	if (!f)
+		return 0;
+	if (fread(&eh, sizeof(eh), 1, f) != 1 || memcmp(eh.e_ident, ELFMAG, SELFMAG) != 0 ||
+		eh.e_ident[EI_CLASS] != ELFCLASS32)
+		goto out;
+	sh = calloc(eh.e_shnum, sizeof(*sh));
+	fseek(f, eh.e_shoff, SEEK_SET);
+	if (fread(sh, sizeof(*sh), eh.e_shnum, f) != eh.e_shnum)
+		goto out;
+	for (int k = 0; k < eh.e_shnum && !found; k++)
+	{
+		if (sh[k].sh_type != SHT_SYMTAB)
+			continue;
+		Elf32_Shdr *strs = &sh[sh[k].sh_link];
+		char *str = malloc(strs->sh_size);
+		Elf32_Sym *sym = malloc(sh[k].sh_size);
+		fseek(f, strs->sh_offset, SEEK_SET);
+		if (fread(str, 1, strs->sh_size, f) != strs->sh_size)
+			strs->sh_size = 0;
+		fseek(f, sh[k].sh_offset, SEEK_SET);
+		if (fread(sym, 1, sh[k].sh_size, f) != sh[k].sh_size)
+			sh[k].sh_size = 0;
+		for (uint32_t n = 0; n < sh[k].sh_size / sizeof(Elf32_Sym); n++)
+		{
+			if (sym[n].st_name < strs->sh_size && ELF32_ST_TYPE(sym[n].st_info) == STT_FUNC &&
+				strcmp(str + sym[n].st_name, name) == 0)
+			{
+				*addr = sym[n].st_value;
+				found = 1;
+				break;
+			}
+		}
+		free(str);
+		free(sym);
+	}
+out:
+	free(sh);
+	fclose(f);
+	return found;
+}
+
+static uint16_t read_sp(avr_t *avr)
+{
+	return avr->data[R_SPL] | (avr->data[R_SPH] << 8);
+}
+
+static void usage(void)
+{
+	fprintf(stderr, "usage: simbench [-c cycles] [-m mcu] [-f hz] [-b PORTPIN@ms:holdms]... [-u] file.elf symbol...\n");
+	exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+	uint64_t max_cycles = 32000000;
+	const char *mcu = "atmega328p";
+	uint32_t freq = 16000000;
+	Button buttons[MAX_BUTTONS];
+	int nbuttons = 0;
+	Probe probes[MAX_PROBES];
+	int nprobes = 0;
+	const char *elf = NULL;
+	int uart = 0;
+	UartPty pty;
+	uint64_t next_poll = 0;
+	int k;
+
+	for (k = 1; k < argc; k++)
+	{
+		if (strcmp(argv[k], "-c") == 0 && k + 1 < argc)
+			max_cycles = strtoull(argv[++k], NULL, 0);
+		else if (strcmp(argv[k], "-m") == 0 && k + 1 < argc)
+			mcu = argv[++k];
+		else if (strcmp(argv[k], "-f") == 0 && k + 1 < argc)
+			freq = strtoul(argv[++k], NULL, 0);
+		else if (strcmp(argv[k], "-b") == 0 && k + 1 < argc)
+		{
+			Button *b = &buttons[nbuttons];
+			unsigned at, hold;
+			if (nbuttons >= MAX_BUTTONS || sscanf(argv[++k], "%c%d@%u:%u", &b->port, &b->pin, &at, &hold) != 4)
+				usage();
+			b->press = (uint64_t)at * (freq / 1000);
+			b->release = b->press + (uint64_t)hold * (freq / 1000);
+			b->state = 0;
+			nbuttons++;
+		}
+		else if (strcmp(argv[k], "-u") == 0)
+			uart = 1;
+		else if (argv[k][0] == '-')
+			usage();
+		else if (!elf)
+			elf = argv[k];
+		else if (nprobes < MAX_PROBES)
+		{
+			memset(&probes[nprobes], 0, sizeof(Probe));
+			probes[nprobes].name = argv[k];
+			probes[nprobes].min = UINT64_MAX;
+			if (!find_symbol(elf, argv[k], &probes[nprobes].addr))
+			{
+				fprintf(stderr, "simbench: %s: no function '%s'\n", elf, argv[k]);
+				return 1;
+			}
+			nprobes++;
+		}
+	}
+	if (!elf || nprobes == 0)
+		usage();
+
+	elf_firmware_t fw;
+	memset(&fw, 0, sizeof(fw));
+	if (elf_read_firmware(elf, &fw) != 0)
+	{
+		fprintf(stderr, "simbench: cannot load %s\n", elf);
+		return 1;
+	}
+	if (!fw.mmcu[0])
+		strncpy(fw.mmcu, mcu, sizeof(fw.mmcu) - 1);
+	if (!fw.frequency)
+		fw.frequency = freq;
+
+	avr_t *avr = avr_make_mcu_by_name(fw.mmcu);
+	if (!avr)
+	{
+		fprintf(stderr, "simbench: unknown mcu %s\n", fw.mmcu);
+		return 1;
+	}
+	avr_init(avr);
+	avr_load_firmware(avr, &fw);
+
+	for (k = 0; k < nbuttons; k++)
+	{
+		buttons[k].irq = avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ(buttons[k].port), buttons[k].pin);
+		avr_raise_irq(buttons[k].irq, 1);
+	}
+
+	if (uart && uart_pty_open(avr, &pty) != 0)
+	{
+		fprintf(stderr, "simbench: cannot open a pty\n");
+		return 1;
+	}
+
+	int state = cpu_Running;
+	while (state != cpu_Done && state != cpu_Crashed && avr->cycle < max_cycles)
+	{
+		state = avr_run(avr);
+
+		if (uart && avr->cycle >= next_poll)
+		{
+			uart_pty_poll(&pty);
+			next_poll = avr->cycle + UART_POLL_CYCLES;
+		}
+
+		for (k = 0; k < nbuttons; k++)
+		{
+			Button *b = &buttons[k];
+			if (b->state == 0 && avr->cycle >= b->press)
+			{
+				avr_raise_irq(b->irq, 0);
+				b->state = 1;
+			}
+			else if (b->state == 1 && avr->cycle >= b->release)
+			{
+				avr_raise_irq(b->irq, 1);
+				b->state = 2;
+			}
+		}
+
+		for (k = 0; k < nprobes; k++)
+		{
+			Probe *p = &probes[k];
+			if (!p->active && avr->pc == p->addr)
+			{
+				p->active = 1;
+				p->start = avr->cycle;
+				p->sp = read_sp(avr);
+				p->ret = ((avr->data[p->sp + 1] << 8) | avr->data[p->sp + 2]) * 2;
+			}
+			else if (p->active && avr->pc == p->ret && read_sp(avr) == p->sp + 2)
+			{
+				uint64_t d = avr->cycle - p->start;
+				p->active = 0;
+				p->calls++;
+				p->total += d;
+				if (d < p->min)
+					p->min = d;
+				if (d > p->max)
+					p->max = d;
+			}
+		}
+	}
+
+	printf("symbol\tcalls\tmin_cycles\tmax_cycles\tavg_cycles\ttotal_cycles\tmax_us\n");
+	for (k = 0; k < nprobes; k++)
+	{
+		Probe *p = &probes[k];
+		if (p->calls == 0)
+		{
+			printf("%s\t0\t-\t-\t-\t-\t-\n", p->name);
+			continue;
+		}
+		printf("%s\t%u\t%llu\t%llu\t%llu\t%llu\t%.1f\n", p->name, p->calls,
+			   (unsigned long long)p->min, (unsigned long long)p->max,
+			   (unsigned long long)(p->total / p->calls), (unsigned long long)p->total,
+			   p->max * 1e6 / fw.frequency);
+	}
+	return state == cpu_Crashed ? 1 : 0;
+}